@@ -51,6 +51,22 @@ ELSE()
   MESSAGE(FATAL_ERROR "Your compiler does not support C++11. Please specify another C++ compiler.")
 ENDIF()
 
+# -----------------------------------------------------------------------------
+# Check for the 128-bit integer extension of the compiler (GCC, Clang)
+# -----------------------------------------------------------------------------
+INCLUDE(CheckCXXSourceCompiles)
+CHECK_CXX_SOURCE_COMPILES("
+#if !defined(__SIZEOF_INT128__)
+#error no 128-bit integers
+#endif
+int main() { __extension__ __int128 x = 1; return (int) ( x - 1 ); }" INT128_FOUND)
+SET(INT128_FOUND_DGTAL 0)
+IF (INT128_FOUND)
+  SET(INT128_FOUND_DGTAL 1)
+  ADD_DEFINITIONS("-DWITH_INT128 ")
+  MESSAGE(STATUS "128-bit integers found.")
+ENDIF()
+
 
 # -----------------------------------------------------------------------------
 # Fixing Catch issue for C++11 and old GCC
@@ -43,6 +43,7 @@
 // Inclusions
 #include <iostream>
 #include <list>
+#include <deque>
 #include <vector>
 #include <string>
 #include "DGtal/base/Common.h"
@@ -76,10 +77,14 @@ namespace DGtal
      href="https://gforge.liris.cnrs.fr/projects/imagene">ImaGene</a>.
 
      @tparam TSpace an arbitrary 2-dimensional model of CSpace.
-     @tparam TSequence a model of boost::Sequence whose elements are points (TSpace::Point). Default is list of points.
+     @tparam TSequence a model of boost::Sequence whose elements are
+     points (TSpace::Point). Default is deque of points, whose vertices
+     are stored in contiguous blocks. The algorithms (e.g. cut) only
+     use range erasures and insertions, so that std::list and
+     std::vector are also valid.
    */
   template < typename TSpace, 
-             typename TSequence = std::list< typename TSpace::Point > >
+             typename TSequence = std::deque< typename TSpace::Point > >
   class LatticePolytope2D 
   {
     BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
@@ -210,7 +215,8 @@ namespace DGtal
 
     /**
        @return the bounding domain of this polygon, i.e. the smallest
-       bounding box containing all the points of this polygon.
+       bounding box containing all the points of this polygon (an
+       empty domain if the polygon has no vertex).
     */
     Domain boundingBoxDomain() const;
 
@@ -536,7 +542,7 @@ namespace DGtal
     mutable Integer _a, _b, _c, _c1, _c3, _den, _g, _fl, _ce;
     mutable Point _A, _B, _A1, _B1, _A2, _B2;
     mutable Vector _N, _DV, _u, _v;
-    mutable std::vector<Point> _inPts, _outPts;
+    mutable std::vector<Point> _inPts, _outPts, _newPts;
 
     // ------------------------- Hidden services ------------------------------
   protected:
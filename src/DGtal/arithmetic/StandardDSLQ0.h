@@ -43,6 +43,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <cstddef>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
@@ -66,7 +68,9 @@ namespace DGtal
   You may move on it point by point with iterators ConstIterator.
   You can find upper and lower leaning points, find points on the
   DSL given one coordinate.  You may extract subsegment with smartDSS() and
-  reversedSmartDSS() algorithms.
+  reversedSmartDSS() algorithms. Many subsegments, possibly of many
+  DSLs, may be extracted at once with batchSmartDSS() and
+  batchReversedSmartDSS().
 
   @tparam TFraction the type chosen to represent fractions, a model
   of CFraction. You may use SternBrocot::Fraction for instance.
@@ -96,6 +100,18 @@ namespace DGtal
     // Model of concepts::CPointPredicate
     typedef typename IC::Point2I Point;
 
+    /// A subsegment query: the points A < B of the DSL of index @a line
+    /// in the range of DSLs given to batchSmartDSS().
+    struct SubsegmentQuery {
+      /// the index of the DSL.
+      std::size_t line;
+      /// the first point of the subsegment.
+      Point A;
+      /// the last point of the subsegment.
+      Point B;
+    };
+    typedef std::vector<SubsegmentQuery> SubsegmentQueries;
+
     /**
        The iterator to move in the standard digital straight line,
        point by point. To move from A to B on the DSL D, visiting
@@ -358,6 +374,38 @@ namespace DGtal
     */
     Self smartDSS( const Point & A, const Point & B ) const;
 
+    /**
+       Answers many subsegment queries with smartDSS(). The queries
+       are grouped by DSL, so that the queries of a DSL are answered
+       one after the other, and the DSLs are processed in parallel if
+       DGtal has been built with OpenMP support (WITH_OPENMP flag set
+       to "true") and the fractions are those of SternBrocot, whose
+       memoized nodes are then shared by all threads. Other kinds of
+       fractions are not thread-safe and the queries are answered
+       sequentially.
+
+       @param lines the DSLs.
+       @param queries the queries, each one on a DSL of @a lines.
+       @param[out] results the minimal DSL containing each query [A,B],
+       in the order of @a queries.
+    */
+    static void batchSmartDSS( const std::vector<Self> & lines,
+                               const SubsegmentQueries & queries,
+                               std::vector<Self> & results );
+
+    /**
+       Answers many subsegment queries with reversedSmartDSS(), as
+       batchSmartDSS().
+
+       @param lines the DSLs.
+       @param queries the queries, each one on a DSL of @a lines.
+       @param[out] results the minimal DSL containing each query [A,B],
+       in the order of @a queries.
+    */
+    static void batchReversedSmartDSS( const std::vector<Self> & lines,
+                                       const SubsegmentQueries & queries,
+                                       std::vector<Self> & results );
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -392,6 +440,19 @@ namespace DGtal
   private:
     static Fraction deepest( Fraction f1, Fraction f2, Fraction f3 );
     static Fraction deepest( Fraction f1, Fraction f2 );
+
+    /**
+       Used by batchSmartDSS and batchReversedSmartDSS.
+       @param lines the DSLs.
+       @param queries the queries, each one on a DSL of @a lines.
+       @param[out] results the minimal DSL containing each query.
+       @param reversed when 'true', uses reversedSmartDSS, otherwise
+       smartDSS.
+    */
+    static void batchSubsegments( const std::vector<Self> & lines,
+                                  const SubsegmentQueries & queries,
+                                  std::vector<Self> & results,
+                                  bool reversed );
   }; // end of class StandardDSLQ0
 
 
@@ -44,6 +44,8 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <atomic>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
 #include "DGtal/kernel/CInteger.h"
@@ -67,6 +69,15 @@ namespace DGtal
    duplicate it. Use static method SternBrocot::fraction to obtain
    your fractions.
 
+   The tree may be used concurrently by several threads, e.g. in the
+   iterations of a parallel loop. Existing nodes are reached without
+   any lock. The creation of the two descendants of a node is
+   protected by one mutex among a fixed number of shards, chosen
+   from the address of the node, so that threads creating different
+   parts of the tree rarely wait for each other. The nodes of a shard
+   are constructed in place in blocks of nodes (an arena), instead of
+   being allocated one by one.
+
    @tparam TInteger the integral type chosen for the fractions.
 
    @tparam TQuotient the integral type chosen for the
@@ -130,10 +141,12 @@ namespace DGtal
       Node* ascendantLeft;
       /// the node that is the right ascendant.
       Node* ascendantRight;
-      /// the node that is the left descendant or 0 (if none exist).
-      Node* descendantLeft;
-      /// the node that is the right descendant or 0 (if none exist).
-      Node* descendantRight;
+      /// the node that is the left descendant or 0 (if none exist),
+      /// atomic since it may be created by another thread.
+      std::atomic<Node*> descendantLeft;
+      /// the node that is the right descendant or 0 (if none exist),
+      /// atomic since it may be created by another thread.
+      std::atomic<Node*> descendantRight;
       /// the node that is its inverse.
       Node* inverse;
     };
@@ -462,15 +475,36 @@ namespace DGtal
 
     // ------------------------- Protected Datas ------------------------------
   private:
+    /// Number of shards of the tree, each with its own mutex and arena.
+    static const unsigned int NbShards = 64;
+    /// Number of nodes of each block of an arena.
+    static const unsigned int BlockSize = 1024;
+
+    /**
+       The nodes created under the mutex of a shard. They are
+       constructed in place in blocks of BlockSize nodes, which are
+       released with the tree.
+    */
+    struct Arena {
+      /// the blocks of nodes, all full except the last one.
+      std::vector<Node*> blocks;
+      /// the number of nodes constructed in the last block.
+      unsigned int nbUsed;
+      /// protects the creation of nodes in this shard.
+      std::mutex mutex;
+    };
+
     // ------------------------- Private Datas --------------------------------
   private:
-    /// Singleton class.
-    static SternBrocot* singleton;
-
     Node* myZeroOverOne;
     Node* myOneOverZero;
     Node* myOneOverOne;
 
+    /// The shards of the tree.
+    Arena myArenas[ NbShards ];
+    /// Protects nbFractions.
+    std::mutex myNbFractionsMutex;
+
     // ------------------------- Hidden services ------------------------------
   private:
 
@@ -497,6 +531,18 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       @param aNode any node.
+       @return the shard that creates the descendants of @a aNode.
+    */
+    Arena & shard( const Node* aNode );
+
+    /**
+       @param anArena an arena whose mutex is locked (or not shared).
+       @return the memory of a new node, to be constructed in place.
+    */
+    static void* allocate( Arena & anArena );
+
   }; // end of class SternBrocot
 
 
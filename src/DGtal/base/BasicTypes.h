@@ -44,6 +44,7 @@
 // Inclusions
 #include <cstdlib>
 #include <iostream>
+#include <string>
 #include <boost/cstdint.hpp>
 
 #ifdef WITH_GMP
@@ -73,6 +74,81 @@ namespace DGtal
   ///signed 94-bit integer.
   typedef boost::int64_t int64_t;
   
+#ifdef WITH_INT128
+  ///signed 128-bit integer (GCC and Clang extension).
+  __extension__ typedef __int128 int128_t;
+  ///unsigned 128-bit integer (GCC and Clang extension).
+  __extension__ typedef unsigned __int128 uint128_t;
+
+  /**
+   * Converts an unsigned 128-bit integer to its base 10 string, since
+   * std::to_string and the standard streams do not know this type.
+   * @param x any integer.
+   * @return the digits of @a x.
+   */
+  inline
+  std::string
+  to_string( uint128_t x )
+  {
+    char digits[ 40 ];
+    char* p = digits + sizeof( digits );
+    *--p = '\0';
+    do
+      {
+        *--p = (char)( '0' + (int)( x % 10 ) );
+        x /= 10;
+      }
+    while ( x != 0 );
+    return std::string( p );
+  }
+
+  /**
+   * Converts a signed 128-bit integer to its base 10 string.
+   * @param x any integer.
+   * @return the sign and digits of @a x.
+   */
+  inline
+  std::string
+  to_string( int128_t x )
+  {
+    return x < 0
+      ? '-' + to_string( uint128_t( 0 ) - (uint128_t) x )
+      : to_string( (uint128_t) x );
+  }
+
+  /**
+   * Writes an unsigned 128-bit integer in base 10.
+   *
+   * @note uint128_t is a builtin type, so argument-dependent lookup
+   * does not find this operator outside namespace DGtal: write
+   * 'DGtal::operator<<( out, x )' or 'out << DGtal::to_string( x )'
+   * there.
+   * @param out the output stream where the object is written.
+   * @param x any integer.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream &
+  operator<<( std::ostream & out, uint128_t x )
+  {
+    return out << to_string( x );
+  }
+
+  /**
+   * Writes a signed 128-bit integer in base 10 (see the note of the
+   * unsigned version about name lookup).
+   * @param out the output stream where the object is written.
+   * @param x any integer.
+   * @return the output stream after the writing.
+   */
+  inline
+  std::ostream &
+  operator<<( std::ostream & out, int128_t x )
+  {
+    return out << to_string( x );
+  }
+#endif
+
 #ifdef WITH_GMP
   #define WITH_BIGINTEGER
   ///Multi-precision integer with GMP implementation.
@@ -68,7 +68,6 @@ namespace DGtal
         DGtal::OpInSTLContainers<Container,Iterator>
              ::erase(aContainer, anIterator);
    * @endcode
-   * @see Preimage2D.ih
    */
 
     //default (iterator type)
@@ -44,6 +44,9 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <algorithm>
+#include <limits>
+#include <utility>
 #include <boost/array.hpp>
 #include <boost/unordered_map.hpp>
 #include "DGtal/kernel/SpaceND.h"
@@ -88,6 +91,14 @@ namespace DGtal
    * This is used to describe the space on which the dec is build and to compute various operators.
    * Once operators or kforms are created, this structure should not be modified.
    *
+   * Derivative and hodge operators (and thus antiderivative and laplace
+   * operators) are assembled in parallel when DGtal is built with OpenMP
+   * support (WITH_OPENMP flag set to "true"). When the inserted cells
+   * fill a large enough part of their bounding box in Khalimsky
+   * coordinates, updateIndexes() also builds a dense table giving the
+   * k-form index of each cell of the box, which replaces hash lookups
+   * during operator assembly.
+   *
    * @tparam dimEmbedded dimension of emmbedded manifold.
    * @tparam dimAmbient dimension of ambient manifold.
    * @tparam TLinearAlgebraBackend linear algebra backend used (i.e. EigenSparseLinearAlgebraBackend).
@@ -496,6 +507,14 @@ namespace DGtal
     Index
     getCellIndex(const Cell& cell) const;
 
+    /**
+     * Check if cell indexes are looked up in the dense cell index table
+     * instead of the cell properties hash map.
+     * @return true if the dense table is used.
+     */
+    bool
+    hasDenseIndexes() const;
+
     /**
      * Return number of elements in discrete k-form.
      * @param order k-form order.
@@ -578,6 +597,31 @@ namespace DGtal
      */
     bool myIndexesNeedUpdate;
 
+    /**
+     * Row offsets of the dense cell index table. Rows are the lines of
+     * Khalimsky cells along the first axis, ordered by their remaining
+     * coordinates over the bounding box of the cells. Cells of row r are
+     * stored in myDenseRowCells[myDenseRowBegins[r] .. myDenseRowBegins[r+1]).
+     * Empty if the row table is too large compared to the number of cells.
+     */
+    std::vector<Index> myDenseRowBegins;
+
+    /**
+     * First Khalimsky coordinate and k-form index of cells, grouped by row
+     * and sorted by first coordinate within each row.
+     */
+    std::vector< std::pair<TInteger, Index> > myDenseRowCells;
+
+    /**
+     * Lower Khalimsky coordinates of the bounding box of the cells.
+     */
+    Point myDenseLower;
+
+    /**
+     * Extents and strides of the row table, first axis excluded.
+     */
+    boost::array<Index, dimAmbient> myDenseExtents, myDenseStrides;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -607,6 +651,38 @@ namespace DGtal
     void
     updateSharpOperator();
 
+    /**
+     * Update dense cell index table from cells indexes.
+     * The table only depends on the rows the cells lie on, so that it is
+     * built for surfaces embedded in higher dimension as well.
+     */
+    void
+    updateDenseIndexes();
+
+    /**
+     * Find k-form index of cell, using the dense cell index table if
+     * available.
+     * @param cell Khalimsky cell.
+     * @return associated k-form index, -1 if cell is not in calculus.
+     */
+    Index
+    findCellIndex(const Cell& cell) const;
+
+    /**
+     * Collect the triplets generated by @a functor for each index in
+     * [0, @a length), in parallel if OpenMP is available.
+     * Triplets are appended in index order, as in a sequential loop.
+     * @tparam TTriplet triplet type.
+     * @tparam TFunctor functor type, called as functor(index, triplets),
+     * must be thread-safe.
+     * @param length number of indexes.
+     * @param functor pushes the triplets of given index into given container.
+     * @param triplets output triplets.
+     */
+    template <typename TTriplet, typename TFunctor>
+    static void
+    assembleTriplets(const Index& length, const TFunctor& functor, std::vector<TTriplet>& triplets);
+
   }; // end of class DiscreteExteriorCalculus
 
 
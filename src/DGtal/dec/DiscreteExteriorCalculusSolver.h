@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/Clone.h"
@@ -58,6 +59,13 @@ namespace DGtal
    * \brief Aim:
    * This wraps a linear algebra solver around a discrete exterior calculus.
    *
+   * When the problem operator changes but keeps the same sparsity
+   * pattern (e.g. time-stepping of a diffusion with varying
+   * coefficients), use \ref update instead of \ref compute: the
+   * symbolic analysis of the previous operator is then reused and
+   * only the numerical factorization is redone. Several right-hand
+   * sides can be solved at once with the vector version of \ref solve.
+   *
    * @tparam TCalculus should be DiscreteExteriorCalculus.
    * @tparam TLinearAlgebraSolver should be a model of CLinearAlgebraSolver.
    * @tparam order_in is the input order of the linear problem.
@@ -81,6 +89,8 @@ namespace DGtal
     typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
     typedef KForm<Calculus, order_in, duality_in> SolutionKForm;
     typedef KForm<Calculus, order_out, duality_out> InputKForm;
+    typedef std::vector<SolutionKForm> SolutionKForms;
+    typedef std::vector<InputKForm> InputKForms;
 
     /**
      * Constructor.
@@ -112,6 +122,40 @@ namespace DGtal
      */
     DiscreteExteriorCalculusSolver& compute(const Operator& linear_operator);
 
+    /**
+     * Symbolic analysis of problem operator. Only the sparsity pattern
+     * of the operator is used. Must be followed by \ref factorize.
+     * @param linear_operator linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& analyzePattern(const Operator& linear_operator);
+
+    /**
+     * Numerical factorization of problem operator.
+     * @pre \ref analyzePattern, \ref compute or \ref update has been
+     * called before with an operator of same sparsity pattern.
+     * @param linear_operator linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& factorize(const Operator& linear_operator);
+
+    /**
+     * Prefactorize problem / set problem operator, reusing the
+     * symbolic analysis of the last operator if \a linear_operator
+     * has the same sparsity pattern (see \ref hasSamePattern).
+     * Otherwise, equivalent to \ref compute.
+     * @param linear_operator linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& update(const Operator& linear_operator);
+
+    /**
+     * @param linear_operator linear operator.
+     * @return 'true' if \a linear_operator has the same size and the
+     * same non-zero entries as the last analyzed operator.
+     */
+    bool hasSamePattern(const Operator& linear_operator) const;
+
     /**
      * Solve prefactorized / set problem input.
      * @param input_kform input k-form.
@@ -119,6 +163,16 @@ namespace DGtal
      */
     SolutionKForm solve(const InputKForm& input_kform) const;
 
+    /**
+     * Solve prefactorized / set problem for several inputs at once.
+     * The inputs are gathered as the columns of a dense matrix, which
+     * is solved in a single call to the linear algebra solver.
+     * @param input_kforms input k-forms, all attached to the calculus
+     * of the problem operator.
+     * @return problem solutions, in the same order as \a input_kforms.
+     */
+    SolutionKForms solve(const InputKForms& input_kforms) const;
+
     /**
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
@@ -127,6 +181,19 @@ namespace DGtal
 
     // ------------------------- Private Datas --------------------------------
   private:
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::DenseMatrix DenseMatrix;
+    typedef typename Operator::Container Container;
+
+    /**
+     * Number of rows and columns of the last analyzed operator.
+     */
+    Index myPatternRows, myPatternCols;
+
+    /**
+     * Compressed outer and inner indices of the last analyzed operator.
+     */
+    std::vector<Index> myPatternOuter, myPatternInner;
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -134,6 +201,12 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Stores the sparsity pattern of \a linear_operator.
+     * @param linear_operator linear operator.
+     */
+    void storePattern(const Operator& linear_operator);
+
   }; // end of class DiscreteExteriorCalculusSolver
 
 
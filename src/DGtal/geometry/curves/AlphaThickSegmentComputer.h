@@ -165,7 +165,6 @@ public:
 
 private:
   struct State{
-    DGtal::MelkmanConvexHull<InputPoint, Functor> melkmanCH;
     /** the last point added at the front of the alpha thick segment */
     InputPoint lastFront;
     /** the last point added at the back of the alpha thick segment */
@@ -610,6 +609,12 @@ private:
   ThicknessDef myThicknessDefinition;
 
 
+  /**
+   * Convex hull of the points of the segment, updated incrementally
+   * (the changes due to a rejected point are undone).
+   **/
+  DGtal::MelkmanConvexHull<InputPoint, Functor> myConvexHull;
+
   /**
    * State of the actual computer
    **/
@@ -641,6 +646,18 @@ protected:
   bool melkmanIsConvexValid() ;
 
 
+  /**
+   * Adds a point to the convex hull and checks if the segment is
+   * still an alpha thick segment. The thickness is computed again
+   * only if the convex hull has been updated. Otherwise, the
+   * convex hull and the state are restored.
+   * @param[in] aPoint the new point.
+   * @return 'true' if the segment thickness is less or equal to the
+   * maximal thickness once the point added, 'false' otherwise.
+   */
+  bool addToConvexHull(const InputPoint &aPoint);
+
+
   /**
    *  Updates the main height of the melkman convex hull
    *   and update the antipodal pairs.
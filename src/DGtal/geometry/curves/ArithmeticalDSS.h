@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <boost/type_traits/is_integral.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
 
@@ -635,6 +636,30 @@ namespace DGtal
      * @see isExtendableFront extendBack
      */
     bool extendFront( const Point& aNewPoint );
+
+    /**
+     * Extends the DSS, at its front, with the consecutive points of
+     * the range [@a aItb, @a aIte) as long as the union is a DSS.
+     * The result is the same as calling extendFront( const Point& )
+     * on each point until it returns 'false'.
+     *
+     * When Coordinate and Integer are fixed-width integral types, the
+     * points are processed by blocks: the steps and the remainders of
+     * all the points of a block are computed at once by a branch-free
+     * loop (that may be vectorized by the compiler), and only the
+     * points that change the slope or the last point of a block are
+     * processed one by one.
+     *
+     * @param aItb begin iterator
+     * @param aIte end iterator
+     * @tparam Iterator a model of forward iterator on points
+     * @return an iterator on the first point that has not been added,
+     * @a aIte if all points have been added.
+     * @see extendFront
+     */
+    template <typename Iterator>
+    Iterator extendFront( const Iterator& aItb, const Iterator& aIte );
+
     /**
      * Tests whether the union between a point, 
      * which is located at the back of the DSS,
@@ -744,6 +769,26 @@ namespace DGtal
      */
     void retractUpdateParameters( const Vector& aNewDirection );
 
+    /**
+     * Extends the DSS with the points of a range, point by point.
+     * @param aItb begin iterator
+     * @param aIte end iterator
+     * @return an iterator on the first point that has not been added.
+     * @see extendFront
+     */
+    template <typename Iterator>
+    Iterator extendFront( const Iterator& aItb, const Iterator& aIte, boost::false_type );
+
+    /**
+     * Extends the DSS with the points of a range, block by block.
+     * @param aItb begin iterator
+     * @param aIte end iterator
+     * @return an iterator on the first point that has not been added.
+     * @see extendFront
+     */
+    template <typename Iterator>
+    Iterator extendFront( const Iterator& aItb, const Iterator& aIte, boost::true_type );
+
 
     // ------------------------- Protected Datas ------------------------------
   protected:
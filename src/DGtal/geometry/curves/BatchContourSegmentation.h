@@ -0,0 +1,282 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchContourSegmentation.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BatchContourSegmentation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchContourSegmentation_RECURSES)
+#error Recursive header files inclusion detected in BatchContourSegmentation.h
+#else // defined(BatchContourSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchContourSegmentation_RECURSES
+
+#if !defined BatchContourSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define BatchContourSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchContourSegmentation
+  /**
+   * Description of template class 'BatchContourSegmentation' <p>
+   * \brief Aim: Common base of the classes that compute the maximal
+   * segments (see SaturatedSegmentation) and an estimation at each
+   * element of a whole set of contours at once, like
+   * BatchMaximalSegmentation and BatchMaximalDCASegmentation.
+   *
+   * The elements of all contours are stored in a single array,
+   * contour after contour. computeAll() processes the contours
+   * independently, in parallel if DGtal has been built with OpenMP
+   * support (WITH_OPENMP flag set to "true"). Results are stored in
+   * flat arrays:
+   * - the maximal segments of contour @a c are the segments of indices
+   * segmentOffset(c) to segmentOffset(c+1)-1 of segments(),
+   * - the estimation at element @a i of contour @a c is the element
+   * elementOffset(c)+i of estimations(), like the element itself in
+   * elements().
+   *
+   * The arrays keep their memory when the object is cleared, so that
+   * a single object may be reused for the contours of each image of a
+   * stack.
+   *
+   * The derived class @a TDerived (curiously recurring template
+   * pattern) must provide:
+   * - the types SegmentComputer and CircularSegmentComputer, the segment
+   * computers used on ConstIterator and ConstCirculator respectively,
+   * - a method 'template <typename TSegmentComputer> void setSegment(
+   * const TSegmentComputer & sc, Segment & s ) const' that fills the
+   * characteristics of segment @a s from the maximal segment @a sc,
+   * - a method 'Estimation estimate( const Segment & s ) const' that
+   * returns the estimation given by segment @a s.
+   *
+   * Each element takes the estimation of its most centered maximal
+   * segment, as MostCenteredMaximalSegmentEstimator does, but the
+   * estimation is computed from the stored segments instead of a
+   * second segmentation of the contour.
+   *
+   * @tparam TDerived the derived class.
+   * @tparam TElement the type of the contour elements.
+   * @tparam TSegment the type of the maximal segments, with at least
+   * the fields 'contour', 'first' and 'last' of type std::size_t.
+   * @tparam TEstimation the type of the estimations.
+   */
+  template <typename TDerived, typename TElement, typename TSegment,
+            typename TEstimation>
+  class BatchContourSegmentation
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TElement Element;
+    typedef std::vector<Element> Elements;
+    typedef typename Elements::const_iterator ConstIterator;
+    typedef Circulator<ConstIterator> ConstCirculator;
+    typedef TSegment Segment;
+    typedef std::vector<Segment> Segments;
+    typedef TEstimation Estimation;
+    typedef std::vector<Estimation> Estimations;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The object has no contour.
+     */
+    BatchContourSegmentation();
+
+    /**
+     * Removes all contours and results, keeping the allocated memory.
+     */
+    void clear();
+
+    /**
+     * Adds a contour given by a range of elements.
+     * @tparam TIterator any forward iterator on values from which an
+     * Element can be constructed.
+     * @param itb begin iterator.
+     * @param ite end iterator.
+     * @param isClosed 'true' if the contour is closed, i.e. the last
+     * element is followed by the first one (which is not repeated).
+     * @return the index of the contour.
+     */
+    template <typename TIterator>
+    std::size_t addContour( TIterator itb, TIterator ite, bool isClosed );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /**
+     * @return the number of contours.
+     */
+    std::size_t size() const;
+
+    /**
+     * @return the elements of all contours, contour after contour.
+     */
+    const Elements & elements() const;
+
+    /**
+     * @param c any contour index between 0 and size() (included).
+     * @return the index in elements() of the first element of contour
+     * @a c, or the number of elements if c == size().
+     */
+    std::size_t elementOffset( std::size_t c ) const;
+
+    /**
+     * @param c any contour index.
+     * @return 'true' if contour @a c is closed.
+     */
+    bool isClosed( std::size_t c ) const;
+
+    /**
+     * @pre the results have been computed with estimations.
+     * @return the estimations at all elements, indexed as elements().
+     */
+    const Estimations & estimations() const;
+
+    /**
+     * @pre the results have been computed.
+     * @return the maximal segments of all contours, contour after contour.
+     */
+    const Segments & segments() const;
+
+    /**
+     * @pre the results have been computed.
+     * @param c any contour index between 0 and size() (included).
+     * @return the index in segments() of the first segment of contour
+     * @a c, or the number of segments if c == size().
+     */
+    std::size_t segmentOffset( std::size_t c ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// Elements of all contours
+    Elements myElements;
+    /// Index of the first element of each contour, plus the number of elements
+    std::vector<std::size_t> myElementOffsets;
+    /// Closed flag of each contour
+    std::vector<char> myClosed;
+    /// Maximal segments of all contours
+    Segments mySegments;
+    /// Index of the first segment of each contour, plus the number of segments
+    std::vector<std::size_t> mySegmentOffsets;
+    /// Estimations at each element
+    Estimations myEstimations;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Maximal segments of each contour, before they are gathered in mySegments
+    std::vector<Segments> myContourSegments;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Computes the maximal segments of all contours and, if @a
+     * withEstimations is 'true', the estimation at each element.
+     * @param withEstimations when 'true', estimations are computed too.
+     */
+    void computeAll( bool withEstimations );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the maximal segments and, if required, the estimations
+     * of the contour bounded by @a itb and @a ite.
+     * @tparam TSegmentComputer the segment computer type.
+     * @param c the contour index.
+     * @param itb begin iterator (or circulator) on the contour elements.
+     * @param ite end iterator (or circulator) on the contour elements.
+     * @param withEstimations when 'true', estimations are computed too.
+     * @param[out] segments the maximal segments of the contour.
+     */
+    template <typename TSegmentComputer>
+    void computeContour( std::size_t c,
+                         const typename TSegmentComputer::ConstIterator & itb,
+                         const typename TSegmentComputer::ConstIterator & ite,
+                         bool withEstimations, Segments & segments );
+
+    /**
+     * Sets the estimation at each element of contour @a c to the
+     * estimation of its most centered maximal segment.
+     * @param c the contour index.
+     * @param segments the maximal segments of the contour, in order.
+     * @param isWrapping 'true' if the contour is closed and its last
+     * segment intersects its first one, so that the elements after the
+     * middle of their intersection take the first segment.
+     */
+    void estimateContour( std::size_t c, const Segments & segments,
+                          bool isWrapping );
+
+    /**
+     * @param it any iterator on myElements.
+     * @return the index of the pointed element in myElements.
+     */
+    std::size_t elementIndex( const ConstIterator & it ) const;
+
+    /**
+     * @param it any circulator on myElements.
+     * @return the index of the pointed element in myElements.
+     */
+    std::size_t elementIndex( const ConstCirculator & it ) const;
+
+  }; // end of class BatchContourSegmentation
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/BatchContourSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchContourSegmentation_h
+
+#undef BatchContourSegmentation_RECURSES
+#endif // else defined(BatchContourSegmentation_RECURSES)
@@ -0,0 +1,272 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchMaximalDCASegmentation.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BatchMaximalDCASegmentation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchMaximalDCASegmentation_RECURSES)
+#error Recursive header files inclusion detected in BatchMaximalDCASegmentation.h
+#else // defined(BatchMaximalDCASegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchMaximalDCASegmentation_RECURSES
+
+#if !defined BatchMaximalDCASegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define BatchMaximalDCASegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/StabbingCircleComputer.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/BatchContourSegmentation.h"
+#include "DGtal/geometry/curves/estimation/SegmentComputerEstimators.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /**
+     * A maximal DCA of a contour computed by
+     * BatchMaximalDCASegmentation. Grid edge indices are relative to
+     * the first grid edge of the contour. For a closed contour, the DCA
+     * may go through the first grid edge, in which case @a last < @a
+     * first.
+     */
+    struct BatchDCASegment
+    {
+      /// Index of the contour
+      std::size_t contour;
+      /// Index of the first grid edge of the DCA
+      std::size_t first;
+      /// Index of the last grid edge of the DCA
+      std::size_t last;
+      /// 'true' if the DCA is also a digital straight segment
+      bool isStraight;
+      /// Curvature of the separating circle (0 if straight), at grid step 1
+      double curvature;
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchMaximalDCASegmentation
+  /**
+   * Description of template class 'BatchMaximalDCASegmentation' <p>
+   * \brief Aim: Computes the maximal digital circular arcs (DCA, see
+   * StabbingCircleComputer and SaturatedSegmentation) and the
+   * curvature given by the most centered maximal DCA (see
+   * MostCenteredMaximalSegmentEstimator and CurvatureFromDCAEstimator)
+   * of a whole set of contours at once.
+   *
+   * A contour is given by its sequence of grid edges, each one being
+   * described by the pair of its inner and outer incident points (see
+   * GridCurve::getIncidentPointsRange). Contours are first added one
+   * by one. Their pairs of points are stored in a single array,
+   * contour after contour, so that the recognition reads them directly
+   * instead of computing them from the cells of a grid curve. Then,
+   * compute() processes the contours independently, in parallel if
+   * DGtal has been built with OpenMP support (WITH_OPENMP flag set to
+   * "true"). Results are stored in flat arrays:
+   * - the maximal DCAs of contour @a c are the segments of indices
+   * segmentOffset(c) to segmentOffset(c+1)-1 of segments(),
+   * - the curvature at grid edge @a i of contour @a c is the element
+   * pairOffset(c)+i of curvatures(), like the edge itself in pairs().
+   *
+   * The storage of the contours and their parallel processing are
+   * those of BatchContourSegmentation: the arrays keep their memory
+   * when the object is cleared, so that a single object may be reused
+   * for the contours of each image of a stack.
+   *
+   * @code
+   * BatchMaximalDCASegmentation<int> batch;
+   * for ( ... ) batch.addContour( gridCurve );
+   * batch.compute( h );
+   * for ( std::size_t i = batch.pairOffset( c ); i < batch.pairOffset( c+1 ); ++i )
+   *   trace.info() << batch.curvatures()[ i ] << std::endl;
+   * @endcode
+   *
+   * @tparam TInteger the type of the point coordinates, a model of CInteger.
+   *
+   * @see testBatchMaximalDCASegmentation.cpp BatchMaximalSegmentation
+   * BatchContourSegmentation
+   */
+  template <typename TInteger>
+  class BatchMaximalDCASegmentation
+    : public BatchContourSegmentation< BatchMaximalDCASegmentation<TInteger>,
+                                       std::pair< PointVector<2, TInteger>,
+                                                  PointVector<2, TInteger> >,
+                                       detail::BatchDCASegment, double >
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TInteger Integer;
+    typedef PointVector<2, Integer> Point;
+    /// Inner and outer incident points of a grid edge
+    typedef std::pair<Point, Point> Pair;
+    typedef std::vector<Pair> Pairs;
+
+    typedef BatchMaximalDCASegmentation<TInteger> Self;
+    typedef BatchContourSegmentation< Self, Pair, detail::BatchDCASegment, double > Base;
+    friend class BatchContourSegmentation< Self, Pair, detail::BatchDCASegment, double >;
+
+    typedef typename Base::ConstIterator ConstIterator;
+    typedef typename Base::ConstCirculator ConstCirculator;
+
+    /// Segment computer used on open contours
+    typedef StabbingCircleComputer<ConstIterator> SegmentComputer;
+    /// Segment computer used on closed contours
+    typedef StabbingCircleComputer<ConstCirculator> CircularSegmentComputer;
+
+    /**
+     * A maximal DCA of a contour (see detail::BatchDCASegment).
+     */
+    typedef detail::BatchDCASegment Segment;
+    typedef std::vector<Segment> Segments;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The object has no contour.
+     */
+    BatchMaximalDCASegmentation();
+
+    /// Adds a contour given by a range of pairs of inner and outer points.
+    using Base::addContour;
+
+    /**
+     * Adds a contour given by the incident points range of a grid curve.
+     * @tparam TKSpace the Khalimsky space of the grid curve.
+     * @param curve any grid curve.
+     * @return the index of the contour.
+     */
+    template <typename TKSpace>
+    std::size_t addContour( const GridCurve<TKSpace> & curve );
+
+    /**
+     * Computes the maximal DCAs of all contours and, if @a
+     * withCurvatures is 'true', the curvature at each grid edge, as
+     * CurvatureFromDCAEstimator (the contours are assumed to be
+     * counter-clockwise oriented, otherwise the signs are opposite).
+     * @param h the grid step used for the curvatures.
+     * @param withCurvatures when 'true', curvatures are computed too.
+     */
+    void compute( double h = 1.0, bool withCurvatures = true );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /**
+     * @return the pairs of incident points of all contours, contour
+     * after contour.
+     */
+    const Pairs & pairs() const;
+
+    /**
+     * @param c any contour index between 0 and size() (included).
+     * @return the index in pairs() of the first grid edge of contour @a
+     * c, or the number of grid edges if c == size().
+     */
+    std::size_t pairOffset( std::size_t c ) const;
+
+    /**
+     * @pre compute( h, true ) has been called.
+     * @return the curvatures given by the most centered maximal DCA at
+     * all grid edges, indexed as pairs().
+     */
+    const std::vector<double> & curvatures() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Grid step of the last computation
+    double myH;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Copies the straightness and the curvature of a maximal DCA.
+     * @param sc any maximal DCA.
+     * @param[out] s the segment whose characteristics are set.
+     */
+    template <typename TSegmentComputer>
+    void setSegment( const TSegmentComputer & sc, Segment & s ) const;
+
+    /**
+     * @param s any maximal DCA.
+     * @return the curvature of the DCA at grid step myH.
+     */
+    double estimate( const Segment & s ) const;
+
+  }; // end of class BatchMaximalDCASegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BatchMaximalDCASegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BatchMaximalDCASegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchMaximalDCASegmentation<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/BatchMaximalDCASegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchMaximalDCASegmentation_h
+
+#undef BatchMaximalDCASegmentation_RECURSES
+#endif // else defined(BatchMaximalDCASegmentation_RECURSES)
@@ -0,0 +1,258 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchMaximalSegmentation.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BatchMaximalSegmentation.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchMaximalSegmentation_RECURSES)
+#error Recursive header files inclusion detected in BatchMaximalSegmentation.h
+#else // defined(BatchMaximalSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchMaximalSegmentation_RECURSES
+
+#if !defined BatchMaximalSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define BatchMaximalSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/BatchContourSegmentation.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /**
+     * A maximal segment of a contour computed by
+     * BatchMaximalSegmentation. Point indices are relative to the
+     * first point of the contour. For a closed contour, the segment may
+     * go through the first point, in which case @a last < @a first.
+     */
+    template <typename TInteger>
+    struct BatchDSSSegment
+    {
+      /// Index of the contour
+      std::size_t contour;
+      /// Index of the first point of the segment
+      std::size_t first;
+      /// Index of the last point of the segment
+      std::size_t last;
+      /// Characteristics of the minimal DSL containing the segment
+      TInteger a, b, mu;
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchMaximalSegmentation
+  /**
+   * Description of template class 'BatchMaximalSegmentation' <p>
+   * \brief Aim: Computes the maximal DSSs (see SaturatedSegmentation
+   * and ArithmeticalDSSComputer) and the tangent vectors given by the
+   * most centered maximal DSS (see MostCenteredMaximalSegmentEstimator)
+   * of a whole set of contours at once.
+   *
+   * Contours are first added one by one (from FreemanChain, GridCurve
+   * or any range of points). Their points are stored in a single
+   * array, contour after contour. Then, compute() processes the
+   * contours independently, in parallel if DGtal has been built with
+   * OpenMP support (WITH_OPENMP flag set to "true"). Results are
+   * stored in flat arrays:
+   * - the maximal segments of contour @a c are the segments of indices
+   * segmentOffset(c) to segmentOffset(c+1)-1 of segments(),
+   * - the tangent vector at point @a i of contour @a c is the element
+   * pointOffset(c)+i of tangents(), like the point itself in points().
+   *
+   * The storage of the contours and their parallel processing are
+   * those of BatchContourSegmentation.
+   *
+   * @code
+   * BatchMaximalSegmentation<int> batch;
+   * for ( ... ) batch.addContour( freemanChain );
+   * batch.compute();
+   * for ( std::size_t s = batch.segmentOffset( c ); s < batch.segmentOffset( c+1 ); ++s )
+   *   trace.info() << batch.segments()[ s ].a << std::endl;
+   * @endcode
+   *
+   * @tparam TInteger the type of the point coordinates, a model of CInteger.
+   * @tparam adjacency the adjacency of the contour points (4 or 8).
+   *
+   * @see testBatchMaximalSegmentation.cpp BatchContourSegmentation
+   */
+  template <typename TInteger, unsigned short adjacency = 4>
+  class BatchMaximalSegmentation
+    : public BatchContourSegmentation< BatchMaximalSegmentation<TInteger, adjacency>,
+                                       PointVector<2, TInteger>,
+                                       detail::BatchDSSSegment<TInteger>,
+                                       PointVector<2, TInteger> >
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef BatchMaximalSegmentation<TInteger, adjacency> Self;
+    typedef BatchContourSegmentation< Self, PointVector<2, TInteger>,
+                                      detail::BatchDSSSegment<TInteger>,
+                                      PointVector<2, TInteger> > Base;
+    friend class BatchContourSegmentation< Self, PointVector<2, TInteger>,
+                                           detail::BatchDSSSegment<TInteger>,
+                                           PointVector<2, TInteger> >;
+
+    typedef TInteger Integer;
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+    typedef std::vector<Point> Points;
+    typedef typename Base::ConstIterator ConstIterator;
+    typedef typename Base::ConstCirculator ConstCirculator;
+
+    /// Segment computer used on open contours
+    typedef ArithmeticalDSSComputer<ConstIterator, Integer, adjacency> SegmentComputer;
+    /// Segment computer used on closed contours
+    typedef ArithmeticalDSSComputer<ConstCirculator, Integer, adjacency> CircularSegmentComputer;
+
+    /**
+     * A maximal segment of a contour (see detail::BatchDSSSegment).
+     */
+    typedef detail::BatchDSSSegment<TInteger> Segment;
+    typedef std::vector<Segment> Segments;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    using Base::addContour;
+
+    /**
+     * Adds a contour given by a Freeman chain. If the chain is closed,
+     * its last point (equal to the first one) is not repeated.
+     * @param fc any Freeman chain.
+     * @return the index of the contour.
+     */
+    std::size_t addContour( const FreemanChain<Integer> & fc );
+
+    /**
+     * Adds a contour given by the points range of a grid curve.
+     * @tparam TKSpace the Khalimsky space of the grid curve.
+     * @param curve any grid curve.
+     * @return the index of the contour.
+     */
+    template <typename TKSpace>
+    std::size_t addContour( const GridCurve<TKSpace> & curve );
+
+    /**
+     * Computes the maximal segments of all contours and, if @a
+     * withTangents is 'true', the tangent vector at each point.
+     * @param withTangents when 'true', tangents are computed too.
+     */
+    void compute( bool withTangents = true );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /**
+     * @return the points of all contours, contour after contour.
+     */
+    const Points & points() const;
+
+    /**
+     * @param c any contour index between 0 and size() (included).
+     * @return the index in points() of the first point of contour @a c,
+     * or the number of points if c == size().
+     */
+    std::size_t pointOffset( std::size_t c ) const;
+
+    /**
+     * @pre compute(true) has been called.
+     * @return the tangent vectors (b,a) of the most centered maximal
+     * segment at all points, indexed as points().
+     */
+    const std::vector<Vector> & tangents() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Copies the characteristics of the minimal DSL of a maximal
+     * segment.
+     * @param sc any maximal segment.
+     * @param[out] s the segment whose characteristics are set.
+     */
+    template <typename TSegmentComputer>
+    void setSegment( const TSegmentComputer & sc, Segment & s ) const;
+
+    /**
+     * @param s any maximal segment.
+     * @return the tangent vector (b,a) of the segment.
+     */
+    Vector estimate( const Segment & s ) const;
+
+  }; // end of class BatchMaximalSegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BatchMaximalSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BatchMaximalSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger, unsigned short adjacency>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchMaximalSegmentation<TInteger, adjacency> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/BatchMaximalSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchMaximalSegmentation_h
+
+#undef BatchMaximalSegmentation_RECURSES
+#endif // else defined(BatchMaximalSegmentation_RECURSES)
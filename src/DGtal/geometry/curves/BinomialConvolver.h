@@ -42,7 +42,12 @@
 // Inclusions
 #include <iostream>
 #include <map>
+#include <vector>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_base_of.hpp>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/IteratorCirculatorTraits.h"
 #include "DGtal/math/Signal.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -78,6 +83,15 @@ namespace DGtal
     typedef TConstIteratorOnPoints ConstIteratorOnPoints;
     typedef typename ConstIteratorOnPoints::value_type Point;
 
+    /// 'true' if an iterator is mapped to its index by a
+    /// subtraction (random-access iterators), 'false' if the mapping
+    /// is stored (other iterators and circulators).
+    BOOST_STATIC_CONSTANT( bool, hasRandomAccessIndex =
+      ( boost::is_same< typename IteratorCirculatorTraits<ConstIteratorOnPoints>::Type,
+                        IteratorType >::value
+        && boost::is_base_of< RandomAccessCategory,
+                              typename IteratorCirculatorTraits<ConstIteratorOnPoints>::Category >::value ) );
+
    /**
       Constructor. The object is not valid.
 
@@ -132,7 +146,8 @@ namespace DGtal
 
     /**
        Given a valid iterator [it], return the corresponding index
-       position in the binomial convolver in logarithmic time. The
+       position in the binomial convolver, in constant time for
+       random-access iterators and in logarithmic time otherwise. The
        method init should have been called before.
 
        @see init
@@ -215,7 +230,8 @@ namespace DGtal
     ///Copy of the end iterator
     ConstIteratorOnPoints myEnd;
 
-    // Stores the mapping Iterator => Index.
+    // Stores the mapping Iterator => Index (only if
+    // hasRandomAccessIndex is 'false').
     std::map<ConstIteratorOnPoints,int> myMapIt2Idx;
 
     // ------------------------- Private Datas --------------------------------
@@ -226,6 +242,18 @@ namespace DGtal
 
   private:
 
+    /**
+       @param it any valid iterator.
+       @return its index, computed as the distance to the begin iterator.
+    */
+    int index( const ConstIteratorOnPoints& it, boost::true_type ) const;
+
+    /**
+       @param it any valid iterator.
+       @return its index, looked up in the stored mapping.
+    */
+    int index( const ConstIteratorOnPoints& it, boost::false_type ) const;
+
     /**
      * Copy constructor.
      * @param other the object to clone.
@@ -246,6 +274,219 @@ namespace DGtal
 
   }; // end of class BinomialConvolver
 
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedBinomialConvolver
+  /**
+     Description of template class 'IndexedBinomialConvolver'. <p>
+
+     @brief Aim: This class represents a 2D contour convolved by some
+     binomial, like BinomialConvolver, but the convolved contour is
+     stored in contiguous arrays and all the geometric quantities are
+     accessed by index (0 is the first point).
+
+     The binomial kernel of size 2n+1 is applied as n passes of the
+     mask [1 2 1]/4 (i.e. twice the box filter [1 1]/2) performed in
+     place, without computing the kernel nor any temporary signal.
+     First and second order derivatives are computed on the fly from
+     the convolved contour. The results are the same as the ones of
+     BinomialConvolver up to floating-point rounding, including the
+     values outside the contour when it is open.
+
+     The convolver may be initialized again and again with other
+     contours, the arrays being reused, which is useful to process
+     many contours in a row.
+
+     @code
+     IndexedBinomialConvolver<double> bc( 10 );
+     bc.init( h, points.begin(), points.end(), true );
+     std::vector<double> curvatures;
+     bc.curvatures( std::back_inserter( curvatures ) );
+     @endcode
+
+     @tparam TValue the type for storing the convolved versions of the
+     contour (double as default).
+
+     @see BinomialConvolver testBinomialConvolver.cpp
+  */
+  template <typename TValue = double>
+  class IndexedBinomialConvolver
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TValue Value;
+
+    /**
+       Constructor. The object is not valid.
+
+       @param n the parameter for the size of the binomial kernel
+       (which is then 2^n).
+
+       @see init
+    */
+    IndexedBinomialConvolver( unsigned int n = 1 );
+
+    /**
+       @param n the parameter for the size of the binomial kernel
+       (which is then 2^n).
+    */
+    void setSize( unsigned int n );
+
+    /**
+       @return the parameter for the size of the binomial kernel
+       (which is then 2^n).
+    */
+    unsigned int size() const;
+
+    /**
+       @tparam ConstIterator a model of forward iterator on points
+       (pointers on points are allowed).
+       @param h grid size (must be >0).
+       @param itb begin iterator
+       @param ite end iterator
+       @return the suggested size for the binomial convolver as
+       ceil( d / pow( h, 1.0/3.0 ) ), with d the diameter of the
+       contour (see BinomialConvolver::suggestedSize).
+    */
+    template <typename ConstIterator>
+    static
+    unsigned int suggestedSize( const double h,
+                                const ConstIterator& itb,
+                                const ConstIterator& ite );
+
+    /**
+       Initializes the convolver with some sequence of points, which
+       are copied and convolved.
+
+       @tparam ConstIterator a model of forward iterator on points
+       (pointers on points are allowed).
+       @param h grid size (must be >0).
+       @param itb begin iterator
+       @param ite end iterator
+       @param isClosed true if the input range is viewed as closed.
+
+       The object is then valid.
+    */
+    template <typename ConstIterator>
+    void init( const double h,
+               const ConstIterator& itb,
+               const ConstIterator& ite,
+               const bool isClosed );
+
+    /**
+     * @return the number of points of the contour.
+     */
+    unsigned int nbPoints() const;
+
+    /**
+     * @param i any index.
+     *
+     * @return the position vector (x[ i ],y[ i ]) (0 is the first point).
+     */
+    std::pair<Value,Value> x( int i ) const;
+
+    /**
+     * @param i any index.
+     *
+     * @return the derivative of the position (x'[ i ],y'[ i ]) (0 is
+     * the first point).
+     */
+    std::pair<Value,Value> dx( int i ) const;
+
+    /**
+     * @param i any index.
+     *
+     * @return the second derivative of the position (x''[ i ],y''[ i
+     * ]) (0 is the first point).
+     */
+    std::pair<Value,Value> d2x( int i ) const;
+
+    /**
+     * @param i any index.
+     *
+     * @return the normalized tangent vector (x'[ i ],y'[ i ]) (0 is
+     * the first point).
+     */
+    std::pair<Value,Value> tangent( int i ) const;
+
+    /**
+     * @param i any index.
+     *
+     * @return the curvature of the signal (0 is the first point).
+
+     * NB: depends on the gridstep.
+     */
+    Value curvature( int i ) const;
+
+    /**
+     * Writes the normalized tangent vectors of all the points of the
+     * contour, from the first one.
+     * @tparam OutputIterator a model of output iterator on std::pair<Value,Value>.
+     * @param result the output iterator.
+     * @return the output iterator after the last written tangent.
+     */
+    template <typename OutputIterator>
+    OutputIterator tangents( OutputIterator result ) const;
+
+    /**
+     * Writes the curvatures of all the points of the contour, from
+     * the first one.
+     * @tparam OutputIterator a model of output iterator on Value.
+     * @param result the output iterator.
+     * @return the output iterator after the last written curvature.
+     */
+    template <typename OutputIterator>
+    OutputIterator curvatures( OutputIterator result ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    unsigned int myN;
+    double myH;
+    bool myIsClosed;
+    unsigned int myNbPoints;
+
+    /// Convolved x-coordinates (padded with zeros if the contour is open)
+    std::vector<Value> myX;
+    /// Convolved y-coordinates (padded with zeros if the contour is open)
+    std::vector<Value> myY;
+    /// Position of the first point in myX and myY
+    int myOffset;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param v either myX or myY.
+     * @param i any index.
+     * @return the i-th value of the convolved signal [v], with the
+     * periodic extension if the contour is closed and 0 outside
+     * otherwise.
+     */
+    Value at( const std::vector<Value>& v, int i ) const;
+
+    /**
+     * Convolves in place the signal [v] by the binomial kernel of size
+     * 2*myN+1.
+     * @param v either myX or myY.
+     */
+    void convolve( std::vector<Value>& v ) const;
+
+  }; // end of class IndexedBinomialConvolver
+
   /**
      Description of template class
      'TangentFromBinomialConvolverFunctor' <p> \brief Aim: This class
@@ -380,6 +621,17 @@ namespace DGtal
   operator<< ( std::ostream & out,
          const BinomialConvolver<TConstIteratorOnPoints,TValue> & object );
 
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedBinomialConvolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedBinomialConvolver' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IndexedBinomialConvolver<TValue> & object );
+
 } // namespace DGtal
 
 
@@ -41,6 +41,7 @@
 #include <iostream>
 #include <exception>
 #include <iomanip>
+#include <vector>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -59,7 +60,8 @@ namespace DGtal
  * one is based on the local computation of lower and upper convex
  * hulls, the other is based on a dual transformation and uses the Farey
  * fan. Implementation requires that the DSL lies in the first octant (0
- * <= a <= b).
+ * <= a <= b). Many subsegments may be computed at once, in parallel,
+ * with batch().
  * @tparam TInteger is the type of integer used
  * @tparam TNumber is the type of number used to represent the input DSL characteristics.
  */
@@ -197,6 +199,44 @@ namespace DGtal
        */
       DSLSubsegment(Number alpha, Number beta, Point &A, Point &B, Number precision = 1e-10);
 
+      /**
+       * A subsegment query: the parameters of a DSL 0 <= ax -by + mu
+       * < b and two points A and B of this DSL.
+       */
+      struct Query
+      {
+        Number a;
+        Number b;
+        Number mu;
+        Point A;
+        Point B;
+      };
+
+      /**
+       * The minimal characteristics (a,b,mu) of a subsegment.
+       */
+      struct Characteristics
+      {
+        Integer a;
+        Integer b;
+        Integer mu;
+      };
+
+      /**
+       * Computes the minimal characteristics of the subsegments of
+       * many queries, as the constructor does for one query. Queries
+       * are independent and are processed in parallel if DGtal has
+       * been built with OpenMP support (WITH_OPENMP flag set to
+       * "true").
+       * @param [in] queries the DSLs and their subsegments [AB].
+       * @param [out] results the characteristics of each subsegment,
+       * in the order of @a queries.
+       * @param [in] type the algorithm, "farey" or "localCH".
+       */
+      static void batch(const std::vector<Query> &queries,
+                        std::vector<Characteristics> &results,
+                        std::string type);
+
 
   protected:
       /**
@@ -279,16 +279,31 @@ namespace DGtal
    *
    * Once the FP is computed, copyFP() is a way of geting its vertices. 
    * In the same way, copyMLP() is a way of getting the vertices of the MLP. 
+   *
+   * The same object may process several ranges with init(). When the
+   * polygon is stored in a std::vector, its memory is then reused
+   * from one range to the next one:
+   * @code
+   FP<ConstCirculator, Integer, 4, std::vector<Point> > theFP; 
+   for ( ... ) //for each closed curve c
+     {
+       theFP.init( c.begin(), c.end() ); 
+       theFP.copyMLP( ... ); 
+     }
+   * @endcode
    * 
    * @tparam TIterator  type ConstIterator on 2D points, 
    * @tparam TInteger (satisfying CInteger) 
    * @tparam connectivity
    * 4 for standard (4-connected) DSS or 8 for naive (8-connected) DSS. 
    * (Any other integers act as 8). 
+   * @tparam TPolygon type of the container of the FP vertices, 
+   * either std::list (default) or std::vector. 
    *
-   * @see testFP.cpp
+   * @see testFP.cpp BatchMLPLengthEstimator
    */
-  template <typename TIterator, typename TInteger, int connectivity>
+  template <typename TIterator, typename TInteger, int connectivity,
+            typename TPolygon = std::list< DGtal::PointVector<2,TInteger> > >
   class FP
   {
 
@@ -306,19 +321,33 @@ namespace DGtal
     
     typedef DGtal::ArithmeticalDSSComputer<TIterator,TInteger,connectivity> DSSComputer;
     
-    typedef std::list<Point> Polygon;
+    typedef TPolygon Polygon;
     
 
 
     // ----------------------- Standard services ------------------------------
   public:
 
+    /**
+     * Default constructor. 
+     * The FP is empty until init() is called. 
+     */
+    FP();
+
     /**
      * Constructor.
      * @param itb  begin iterator
      * @param ite  end iterator
      */
     FP(const TIterator& itb, const TIterator& ite);
+
+    /**
+     * Computes the FP of a new range, 
+     * forgetting the previous one. 
+     * @param itb  begin iterator
+     * @param ite  end iterator
+     */
+    void init(const TIterator& itb, const TIterator& ite);
   
     /**
      * Destructor.
@@ -388,13 +417,17 @@ namespace DGtal
     /**
      * A DSS adapter is returned according to the local convexity/concavity
      * @param aDSS a DSS lying on the range to process
-     * @return an adapter to @a aDSS for convex or concave part
+     * @param aConvexAdapter an adapter to @a aDSS for convex parts
+     * @param aConcaveAdapter an adapter to @a aDSS for concave parts
+     * @return either @a aConvexAdapter or @a aConcaveAdapter
      *
      * @tparam Adapter type that adapts a DSS computer 
      * @see details::DSSDecorator details::DSSDecorator4ConvexParts details::DSSDecorator4ConcaveParts
      */
     template<typename Adapter>
-    Adapter* initConvexityConcavity( typename Adapter::DSS &aDSS );
+    Adapter* initConvexityConcavity( typename Adapter::DSS &aDSS, 
+                                     Adapter* aConvexAdapter, 
+                                     Adapter* aConcaveAdapter );
 
     /**
      * Removing step
@@ -532,9 +565,9 @@ namespace DGtal
    * @param object the object of class 'FP' to write.
    * @return the output stream after the writing.
    */
-  template <typename TIterator, typename TInteger, int connectivity>
+  template <typename TIterator, typename TInteger, int connectivity, typename TPolygon>
   std::ostream&
-  operator<< ( std::ostream & out, const FP<TIterator,TInteger,connectivity> & object );
+  operator<< ( std::ostream & out, const FP<TIterator,TInteger,connectivity,TPolygon> & object );
 
 } // namespace DGtal
 
@@ -0,0 +1,439 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PackedFreemanChain.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: Compact representation of a 4-connected Freeman chain,
+   * whose codes are packed in 64-bit words (2 bits per move, 32 moves
+   * per word).
+   *
+   * Whereas FreemanChain stores one character per move, this class
+   * needs 4 times less memory, so that millions of contours can be kept
+   * in memory. Moreover:
+   * - the points are decoded four moves at a time with a table indexed
+   * by the bytes of the words (see getPoints()), which is also used to
+   * compute the bounding box (see computeBoundingBox()),
+   * - the total displacement and the numbers of turns are computed
+   * word by word by counting bits (see totalDisplacement(), countTurns()
+   * and ccwLoops()),
+   * - chains are read from and written to streams in the same format
+   * as FreemanChain (see read() and write()) without intermediate
+   * string.
+   *
+   * As for FreemanChain, a chain of size() moves has size()+1 points,
+   * visited by ConstIterator from begin() to end().
+   *
+   * @code
+   * std::ifstream instream( "contour.fc" );
+   * PackedFreemanChain<int> pfc( instream );
+   * std::vector< PointVector<2,int> > points;
+   * pfc.getPoints( std::back_inserter( points ) );
+   * @endcode
+   *
+   * @tparam TInteger the type of the point coordinates, a model of CInteger.
+   *
+   * @see FreemanChain testPackedFreemanChain.cpp
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TInteger Integer;
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+    /// Type of the words in which the codes are packed
+    typedef DGtal::uint64_t Word;
+
+    /// Number of codes in a word
+    BOOST_STATIC_CONSTANT( unsigned int, codesPerWord = 32 );
+
+    /**
+     * Forward iterator on the points of the chain, storing the current
+     * point.
+     */
+    class ConstIterator : public
+      std::iterator<std::forward_iterator_tag, Point, std::ptrdiff_t, const Point*, const Point&>
+    {
+    public:
+
+      /**
+       * Default constructor. The object is not valid.
+       */
+      ConstIterator();
+
+      /**
+       * Constructor.
+       * @param aChain the visited chain.
+       * @param aPos the index of the point (from 0 to aChain.size()+1).
+       * @param aPoint the point of index @a aPos.
+       */
+      ConstIterator( const PackedFreemanChain & aChain, Index aPos, const Point & aPoint );
+
+      /**
+       * @return the current point.
+       */
+      const Point & operator*() const;
+
+      /**
+       * @return a pointer on the current point.
+       */
+      const Point * operator->() const;
+
+      /**
+       * Goes to the next point.
+       * @return a reference on this.
+       */
+      ConstIterator & operator++();
+
+      /**
+       * Goes to the next point.
+       * @return the iterator before moving.
+       */
+      ConstIterator operator++( int );
+
+      /**
+       * @return the index of the current point.
+       */
+      Index position() const;
+
+      /**
+       * @param other any iterator on the same chain.
+       * @return 'true' if both iterators point to the same position.
+       */
+      bool operator==( const ConstIterator & other ) const;
+
+      /**
+       * @param other any iterator on the same chain.
+       * @return 'true' if both iterators point to different positions.
+       */
+      bool operator!=( const ConstIterator & other ) const;
+
+    private:
+      /// The visited chain.
+      const PackedFreemanChain* myChain;
+      /// The index of the current point.
+      Index myPos;
+      /// The current point.
+      Point myPoint;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param x the abscissa of the first point.
+     * @param y the ordinate of the first point.
+     */
+    PackedFreemanChain( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a Freeman chain.
+     * @param fc any Freeman chain.
+     */
+    PackedFreemanChain( const FreemanChain<Integer> & fc );
+
+    /**
+     * Constructor from a stream in the Freeman chain format.
+     * @param in any input stream.
+     * @see read
+     */
+    PackedFreemanChain( std::istream & in );
+
+    /**
+     * @param other the object to compare with.
+     * @return 'true' if both chains have the same first point and the
+     * same codes.
+     */
+    bool operator==( const PackedFreemanChain & other ) const;
+
+    /**
+     * @param other the object to compare with.
+     * @return 'false' if equal, 'true' otherwise.
+     */
+    bool operator!=( const PackedFreemanChain & other ) const;
+
+    /**
+     * @return the equivalent Freeman chain.
+     */
+    FreemanChain<Integer> toFreemanChain() const;
+
+    // ----------------------- Codes --------------------------------------
+  public:
+
+    /**
+     * @return the number of moves of the chain.
+     */
+    Size size() const;
+
+    /**
+     * @param pos an index between 0 and size()-1.
+     * @return the code of move @a pos, between 0 and 3.
+     */
+    unsigned int code( Index pos ) const;
+
+    /**
+     * Adds a move at the end of the chain.
+     * @param aCode any code between 0 and 3.
+     * @return a reference on this.
+     */
+    PackedFreemanChain & extend( unsigned int aCode );
+
+    /**
+     * Removes all moves. The first point is kept.
+     */
+    void clear();
+
+    /**
+     * @return the words in which the codes are packed, the code of move
+     * @a i being given by the bits 2(i%32) and 2(i%32)+1 of word i/32.
+     */
+    const std::vector<Word> & words() const;
+
+    // ----------------------- Points --------------------------------------
+  public:
+
+    /**
+     * @return the first point of the chain.
+     */
+    Point firstPoint() const;
+
+    /**
+     * @return the last point of the chain.
+     */
+    Point lastPoint() const;
+
+    /**
+     * Computes the total displacement by counting the codes of each
+     * word, in O(size()/32).
+     * @return the vector from the first point to the last point.
+     */
+    Vector totalDisplacement() const;
+
+    /**
+     * @return 'true' if the last point is equal to the first point.
+     */
+    bool isClosed() const;
+
+    /**
+     * Computes the bounding box of the points, four moves at a time.
+     * @param[out] min_x the minimal abscissa.
+     * @param[out] min_y the minimal ordinate.
+     * @param[out] max_x the maximal abscissa.
+     * @param[out] max_y the maximal ordinate.
+     */
+    void computeBoundingBox( Integer & min_x, Integer & min_y,
+                             Integer & max_x, Integer & max_y ) const;
+
+    /**
+     * Writes the size()+1 points of the chain, decoded four moves at a
+     * time.
+     * @tparam TOutputIterator any output iterator on points.
+     * @param out the output iterator.
+     * @return the output iterator after the last point.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator getPoints( TOutputIterator out ) const;
+
+    /**
+     * @return an iterator on the first point.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator after the last point.
+     */
+    ConstIterator end() const;
+
+    // ----------------------- Turns --------------------------------------
+  public:
+
+    /**
+     * Counts the turns between consecutive moves, word by word, by
+     * counting bits. If the chain is closed, the turn between the last
+     * and the first moves is counted too.
+     * @param[out] nbCcw the number of counterclockwise turns.
+     * @param[out] nbCw the number of clockwise turns.
+     * @param[out] nbUTurns the number of U-turns.
+     */
+    void countTurns( Size & nbCcw, Size & nbCw, Size & nbUTurns ) const;
+
+    /**
+     * @return the number of counterclockwise loops of a closed chain
+     * without U-turn (1 for a simple counterclockwise contour, -1 for a
+     * simple clockwise one), 0 if the chain is open or has a U-turn.
+     * @see FreemanChain::ccwLoops
+     */
+    int ccwLoops() const;
+
+    // ----------------------- Streams --------------------------------------
+  public:
+
+    /**
+     * Reads a chain from a stream in the Freeman chain format: lines
+     * beginning with '#' are skipped, then the coordinates of the first
+     * point and the codes are read. The codes are packed as soon as
+     * they are read.
+     * @param in any input stream.
+     * @param c (returns) the chain.
+     * @return 'true' if a chain has been read, 'false' otherwise.
+     */
+    static bool read( std::istream & in, PackedFreemanChain & c );
+
+    /**
+     * Writes a chain to a stream in the Freeman chain format.
+     * @param out any output stream.
+     * @param c any chain.
+     */
+    static void write( std::ostream & out, const PackedFreemanChain & c );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The first point
+    Point myFirstPoint;
+    /// The number of moves
+    Size mySize;
+    /// The packed codes
+    std::vector<Word> myWords;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Decoding table of the 256 bytes, i.e. sequences of four codes.
+     */
+    struct ByteTable
+    {
+      /// Builds the table
+      ByteTable();
+      /// Offsets of the points after 1, 2, 3 and 4 moves
+      signed char x[ 256 ][ 4 ], y[ 256 ][ 4 ];
+      /// Bounding box of these offsets and of (0,0)
+      signed char minX[ 256 ], maxX[ 256 ], minY[ 256 ], maxY[ 256 ];
+    };
+
+    /**
+     * @return the decoding table of the bytes.
+     */
+    static const ByteTable & byteTable();
+
+    /**
+     * @param w any word.
+     * @return the number of bits set in @a w.
+     */
+    static unsigned int popCount( Word w );
+
+    /**
+     * @param nbCodes any number of codes between 0 and codesPerWord.
+     * @return the mask of the low bits of the first @a nbCodes codes of
+     * a word.
+     */
+    static Word lowBitsMask( Size nbCodes );
+
+    /**
+     * @param aCode any code between 0 and 3.
+     * @return the displacement of the move.
+     */
+    static Vector displacement( unsigned int aCode );
+
+  }; // end of class PackedFreemanChain
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/geometry/curves/SegmentComputerUtils.h"
@@ -451,6 +452,33 @@ namespace DGtal
      */
     typename SaturatedSegmentation::SegmentComputerIterator end() const;
 
+    /**
+     * Computes the whole set of maximal segments by divide-and-conquer,
+     * in parallel if DGtal has been built with OpenMP support
+     * (WITH_OPENMP flag set to "true").
+     *
+     * The range is split into @a nbChunks chunks. For each chunk, the
+     * last maximal segment passing through its first element is
+     * computed, so that it overlaps the previous chunk. The maximal
+     * segments of each chunk are then computed independently from
+     * this segment up to the one of the next chunk (excluded). The
+     * segments of all chunks are finally concatenated in order.
+     * The segments are exactly those given by the iteration from
+     * begin() to end().
+     *
+     * Nb: the divide-and-conquer scheme is only used to process the
+     * whole underlying range bounded by classical iterators in the
+     * modes "First", "MostCentered" and "Last". Otherwise, this method
+     * is equivalent to the iteration from begin() to end().
+     *
+     * @param segments (returned) the maximal segments, in the order of
+     * the iteration from begin() to end().
+     * @param nbChunks the number of chunks, or 0 (default) to use the
+     * maximal number of threads.
+     */
+    void computeInParallel( std::vector<SegmentComputer>& segments,
+                            unsigned int nbChunks = 0 ) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -520,6 +548,24 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Computes the maximal segments by divide-and-conquer.
+     * @param segments (returned) the maximal segments.
+     * @param nbChunks the number of chunks.
+     * @see computeInParallel
+     */
+    void computeInParallel( std::vector<SegmentComputer>& segments,
+                            unsigned int nbChunks, IteratorType ) const;
+
+    /**
+     * Computes the maximal segments by iterating from begin() to end().
+     * @param segments (returned) the maximal segments.
+     * @param nbChunks not used.
+     * @see computeInParallel
+     */
+    void computeInParallel( std::vector<SegmentComputer>& segments,
+                            unsigned int nbChunks, CirculatorType ) const;
+
   }; // end of class SaturatedSegmentation
 
 
@@ -0,0 +1,206 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StreamingDSSSegmentation.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module StreamingDSSSegmentation.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StreamingDSSSegmentation_RECURSES)
+#error Recursive header files inclusion detected in StreamingDSSSegmentation.h
+#else // defined(StreamingDSSSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StreamingDSSSegmentation_RECURSES
+
+#if !defined StreamingDSSSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define StreamingDSSSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StreamingDSSSegmentation
+  /**
+   * Description of template class 'StreamingDSSSegmentation' <p>
+   * \brief Aim: Computes the greedy segmentation of a stream of points
+   * into DSSs (see ArithmeticalDSS), the points being received chunk
+   * by chunk, e.g. from a decoded Freeman chain or from a file reader.
+   *
+   * The points of each chunk are added to the current DSS with
+   * ArithmeticalDSS::extendFront( const Iterator&, const Iterator& ),
+   * which processes the points by blocks when the coordinates and the
+   * remainders are fixed-width integers. When a point cannot be added,
+   * the current DSS is written to the output and a new DSS starts at
+   * its last point (or at the point itself if both points are not
+   * adjacent), like in GreedySegmentation with the "Truncate" mode.
+   * Only the current DSS is kept in memory, whatever the length of
+   * the stream.
+   *
+   * @code
+   * typedef StreamingDSSSegmentation<int, int, 4> Segmentation;
+   * Segmentation segmentation;
+   * std::vector<Segmentation::DSS> segments;
+   * while ( ... ) // a chunk of points is read in 'buffer'
+   *   segmentation.push( buffer.begin(), buffer.end(), std::back_inserter( segments ) );
+   * segmentation.flush( std::back_inserter( segments ) );
+   * @endcode
+   *
+   * @tparam TCoordinate a model of integer for the DSS parameters and
+   * the point coordinates.
+   * @tparam TInteger a model of integer for the intercepts and the
+   * remainders.
+   * @tparam adjacency the adjacency of the points (4 or 8).
+   *
+   * @see ArithmeticalDSS GreedySegmentation testStreamingDSSSegmentation.cpp
+   */
+  template <typename TCoordinate,
+            typename TInteger = TCoordinate,
+            unsigned short adjacency = 8>
+  class StreamingDSSSegmentation
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef ArithmeticalDSS<TCoordinate, TInteger, adjacency> DSS;
+    typedef typename DSS::Coordinate Coordinate;
+    typedef typename DSS::Integer Integer;
+    typedef typename DSS::Point Point;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. No point has been received.
+     */
+    StreamingDSSSegmentation();
+
+    /**
+     * Forgets the current DSS and all the received points.
+     */
+    void clear();
+
+    /**
+     * Receives a chunk of points, following the previously received
+     * points, and writes the DSSs that are completed.
+     * @tparam Iterator a model of forward iterator on points.
+     * @tparam OutputIterator a model of output iterator on DSSs.
+     * @param itb begin iterator.
+     * @param ite end iterator.
+     * @param out the output iterator.
+     * @return the output iterator after the last written DSS.
+     */
+    template <typename Iterator, typename OutputIterator>
+    OutputIterator push( const Iterator& itb, const Iterator& ite, OutputIterator out );
+
+    /**
+     * Writes the current DSS, if any, and forgets all the received
+     * points.
+     * @tparam OutputIterator a model of output iterator on DSSs.
+     * @param out the output iterator.
+     * @return the output iterator after the written DSS.
+     */
+    template <typename OutputIterator>
+    OutputIterator flush( OutputIterator out );
+
+    /**
+     * @return 'true' if no point has been received since the last call
+     * to flush() or clear().
+     */
+    bool isEmpty() const;
+
+    /**
+     * @pre isEmpty() is 'false'.
+     * @return the current DSS, ending at the last received point.
+     */
+    const DSS& current() const;
+
+    /**
+     * @return the number of points received since the last call to
+     * flush() or clear().
+     */
+    Size nbPoints() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The current DSS
+    DSS myDSS;
+    /// 'true' if there is no current DSS
+    bool myIsEmpty;
+    /// Number of received points
+    Size myNbPoints;
+
+  }; // end of class StreamingDSSSegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StreamingDSSSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StreamingDSSSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCoordinate, typename TInteger, unsigned short adjacency>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const StreamingDSSSegmentation<TCoordinate, TInteger, adjacency> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/StreamingDSSSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StreamingDSSSegmentation_h
+
+#undef StreamingDSSSegmentation_RECURSES
+#endif // else defined(StreamingDSSSegmentation_RECURSES)
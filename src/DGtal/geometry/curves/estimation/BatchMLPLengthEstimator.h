@@ -0,0 +1,267 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchMLPLengthEstimator.h
+ * @brief Computes the MLP and FP lengths of many closed digital curves.
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BatchMLPLengthEstimator.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testLengthEstimators.cpp
+ */
+
+#if defined(BatchMLPLengthEstimator_RECURSES)
+#error Recursive header files inclusion detected in BatchMLPLengthEstimator.h
+#else // defined(BatchMLPLengthEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchMLPLengthEstimator_RECURSES
+
+#if !defined BatchMLPLengthEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define BatchMLPLengthEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/type_traits/is_base_of.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/geometry/curves/FP.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchMLPLengthEstimator
+  /**
+   * Description of template class 'BatchMLPLengthEstimator' <p>
+   * \brief Aim: computes the FP, the MLP and their lengths for
+   * a whole set of closed 4-connected digital curves,
+   * e.g. the contours of all the connected components of an image.
+   *
+   * The curves are processed in parallel if OpenMP is available.
+   * Each thread computes the FP of its curves with the same FP
+   * object, whose vertices are stored in a std::vector, so that
+   * its memory is reused from one curve to the next one (see FP::init()).
+   * The vertices of the FP and the MLP of each curve are kept in
+   * vectors that are themselves reused by the next call to init().
+   *
+   * The lengths are exactly the ones returned by MLPLengthEstimator
+   * and FPLengthEstimator for a closed curve.
+   *
+   * @code
+   std::vector< std::vector<Z2i::Point> > contours;
+   ...
+   BatchMLPLengthEstimator<Z2i::Integer> estimator;
+   estimator.init( h, contours.begin(), contours.end() );
+   for ( unsigned int i = 0; i < estimator.size(); ++i )
+     std::cout << estimator.eval( i ) << " " << estimator.mlp( i ).size() << std::endl;
+   * @endcode
+   *
+   * @tparam TInteger a model of CInteger for the point coordinates.
+   *
+   * @see FP MLPLengthEstimator FPLengthEstimator
+   */
+  template <typename TInteger = int>
+  class BatchMLPLengthEstimator
+  {
+    // ----------------------- Types ------------------------------
+  public:
+
+    typedef TInteger Integer;
+    typedef DGtal::PointVector<2,TInteger> Point;
+    typedef DGtal::PointVector<2,double> RealPoint;
+    typedef DGtal::PointVector<2,double> RealVector;
+    typedef double Quantity;
+    typedef std::size_t Size;
+
+    /// vertices of a faithful polygon
+    typedef std::vector<Point> FaithfulPolygon;
+    /// vertices of a minimum length polygon
+    typedef std::vector<RealPoint> MinimumLengthPolygon;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Default Constructor.
+     */
+    BatchMLPLengthEstimator();
+
+    /**
+     * Destructor.
+     */
+    ~BatchMLPLengthEstimator();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computes the FP, the MLP and their lengths for each curve
+     * of a range of closed curves, forgetting the previous ones.
+     *
+     * @param h grid size (must be >0).
+     * @param itb begin iterator on the curves
+     * @param ite end iterator on the curves
+     *
+     * @tparam TCurveIterator a model of random access iterator
+     * (the curves are read as itb[ i ] in the parallel loop)
+     * whose value type is a range of 4-connected points
+     * (e.g. std::vector<Point>), with a nested type const_iterator
+     * and methods begin() and end(). The first point must not be
+     * repeated at the end of the range.
+     *
+     * @throw InputException if a curve is not 4-connected.
+     */
+    template <typename TCurveIterator>
+    void init( const double h, const TCurveIterator& itb, const TCurveIterator& ite );
+
+    /**
+     * @return the number of curves given to init().
+     */
+    Size size() const;
+
+    /**
+     * @param i index of a curve
+     * @return the length of the MLP of the @a i-th curve.
+     */
+    Quantity eval( const Size i ) const;
+
+    /**
+     * @param i index of a curve
+     * @return the length of the FP of the @a i-th curve.
+     */
+    Quantity evalFP( const Size i ) const;
+
+    /**
+     * @return the lengths of the MLP of all the curves.
+     */
+    const std::vector<Quantity>& lengths() const;
+
+    /**
+     * @return the lengths of the FP of all the curves.
+     */
+    const std::vector<Quantity>& lengthsFP() const;
+
+    /**
+     * @param i index of a curve
+     * @return the vertices of the MLP of the @a i-th curve.
+     */
+    const MinimumLengthPolygon& mlp( const Size i ) const;
+
+    /**
+     * @param i index of a curve
+     * @return the vertices of the FP of the @a i-th curve.
+     */
+    const FaithfulPolygon& fp( const Size i ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+      // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Grid size.
+    double myH;
+
+    ///vertices of the FP of each curve
+    std::vector<FaithfulPolygon> myFPs;
+
+    ///vertices of the MLP of each curve
+    std::vector<MinimumLengthPolygon> myMLPs;
+
+    ///length of the MLP of each curve
+    std::vector<Quantity> myLengths;
+
+    ///length of the FP of each curve
+    std::vector<Quantity> myLengthsFP;
+
+    ///Boolean to make sure that init() has been called before eval().
+    bool myIsInitBefore;
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    BatchMLPLengthEstimator ( const BatchMLPLengthEstimator & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    BatchMLPLengthEstimator & operator= ( const BatchMLPLengthEstimator & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPolygon the vertices of a closed polygon
+     * @return the length of @a aPolygon, summed in the same
+     * order as in MLPLengthEstimator::eval().
+     */
+    template <typename TPoint>
+    static Quantity closedLength( const std::vector<TPoint>& aPolygon );
+
+  }; // end of class BatchMLPLengthEstimator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BatchMLPLengthEstimator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BatchMLPLengthEstimator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchMLPLengthEstimator<T> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/estimation/BatchMLPLengthEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchMLPLengthEstimator_h
+
+#undef BatchMLPLengthEstimator_RECURSES
+#endif // else defined(BatchMLPLengthEstimator_RECURSES)
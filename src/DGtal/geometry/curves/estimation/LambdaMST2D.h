@@ -38,6 +38,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <vector>
 #include <cmath>
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/kernel/CSpace.h"
@@ -110,6 +111,23 @@ namespace DGtal {
     template <typename OutputIterator>
     OutputIterator eval ( const ConstIterator & itb, const ConstIterator & ite, 
                          OutputIterator result );
+
+    /**
+     * @tparam OutputIterator writable iterator.
+     * Parallel computation of the tangent directions for all points of a curve.
+     * The maximal segments are first computed in parallel chunks (see
+     * SaturatedSegmentation::computeInParallel) and stored as intervals of
+     * indices, then the segments covering each point are blended in parallel.
+     * The result is the same as the one of eval ( itb, ite, result ).
+     * @pre TSegmentation is a SaturatedSegmentation.
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param result writable iterator over a container which stores estimated tangent directions.
+     * @param nbChunks number of chunks (0 for the number of threads).
+     */
+    template <typename OutputIterator>
+    OutputIterator evalInParallel ( const ConstIterator & itb, const ConstIterator & ite,
+                                    OutputIterator result, unsigned int nbChunks = 0 );
     
     // ----------------------- Standard services ------------------------------
   public:
@@ -131,6 +149,21 @@ namespace DGtal {
      */
     template <typename OutputIterator>
     void accumulate ( std::vector < Value > & outValues, OutputIterator & result );
+
+    /**
+     * @brief Computes the maximal segments of [itb, ite) and the intervals of
+     * indices they cover: the k-th segment covers the indices of [firsts[k], ends[k]).
+     *
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param nbChunks number of chunks (0 for the number of threads).
+     * @param segments (returns) the maximal segments.
+     * @param firsts (returns) the index of the first point of each segment.
+     * @param ends (returns) the index after the last point of each segment.
+     */
+    void computeCover ( const ConstIterator & itb, const ConstIterator & ite, unsigned int nbChunks,
+                        std::vector < SegmentComputer > & segments,
+                        std::vector < unsigned int > & firsts, std::vector < unsigned int > & ends );
     
     // ------------------------- Private Datas --------------------------------
   private:
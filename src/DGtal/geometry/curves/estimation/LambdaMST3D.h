@@ -38,6 +38,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <vector>
 #include <cmath>
 #include <map>
 #include <DGtal/base/Common.h>
@@ -118,6 +119,24 @@ namespace DGtal {
     template <typename OutputIterator>
     OutputIterator eval ( const ConstIterator & itb, const ConstIterator & ite, 
                         OutputIterator result );
+
+    /**
+     * @tparam OutputIterator writable iterator.
+     * Parallel computation of the tangent directions for all points of a curve.
+     * The maximal segments are first computed in parallel chunks (see
+     * SaturatedSegmentation::computeInParallel) and stored as intervals of
+     * indices, then the segments covering each point are blended in parallel.
+     * The result is the same as the one of eval ( itb, ite, result ).
+     * The points of the curve are assumed to be pairwise distinct.
+     * @pre TSegmentation is a SaturatedSegmentation.
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param result writable iterator over a container which stores estimated tangent directions.
+     * @param nbChunks number of chunks (0 for the number of threads).
+     */
+    template <typename OutputIterator>
+    OutputIterator evalInParallel ( const ConstIterator & itb, const ConstIterator & ite,
+                                    OutputIterator result, unsigned int nbChunks = 0 );
     
     // ------------------------- Internals ------------------------------------
   protected:
@@ -137,6 +156,40 @@ namespace DGtal {
      */
     template <typename OutputIterator>
     void accumulate ( std::multimap < Point, Value > & outValues, const ConstIterator& itb, const ConstIterator& ite, OutputIterator & result );
+
+    /**
+     * @brief Computes the maximal segments of [itb, ite) and the intervals of
+     * indices they cover: the k-th segment covers the indices of [firsts[k], ends[k]).
+     *
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param nbChunks number of chunks (0 for the number of threads).
+     * @param segments (returns) the maximal segments.
+     * @param firsts (returns) the index of the first point of each segment.
+     * @param ends (returns) the index after the last point of each segment.
+     */
+    void computeCover ( const ConstIterator & itb, const ConstIterator & ite, unsigned int nbChunks,
+                        std::vector < SegmentComputer > & segments,
+                        std::vector < unsigned int > & firsts, std::vector < unsigned int > & ends );
+
+    /**
+     * @brief Accumulates the partial results of the points of indices in [i1, i2),
+     * reversing the direction vectors as in accumulate.
+     *
+     * @param segments the maximal segments.
+     * @param firsts the index of the first point of each segment.
+     * @param ends the index after the last point of each segment.
+     * @param i1 first index.
+     * @param i2 index after the last one.
+     * @param prev partial result preceding the one of the first segment covering i1.
+     * @param tangents (returns) estimated tangent directions, from index i1.
+     * @return 'true' if the last partial result has been reversed.
+     */
+    bool accumulateInterval ( const std::vector < SegmentComputer > & segments,
+                              const std::vector < unsigned int > & firsts,
+                              const std::vector < unsigned int > & ends,
+                              unsigned int i1, unsigned int i2, Value prev,
+                              RealVector * tangents ) const;
     
     // ------------------------- Private Datas --------------------------------
   private:
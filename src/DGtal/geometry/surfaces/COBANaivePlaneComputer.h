@@ -44,7 +44,9 @@
 // Inclusions
 #include <iostream>
 #include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CSpace.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -94,7 +96,16 @@ namespace DGtal
    * Note on execution times: The user should favor int64_t instead of
    * BigInteger whenever possible (diameter smaller than 500). The
    * speed-up is between 10 and 20 for these diameters. For greater
-   * diameters, it is necessary to use BigInteger (see below).
+   * diameters, it is necessary to use int128_t or BigInteger (see
+   * below). COBAPromotingNaivePlaneComputer chooses the narrowest
+   * type according to the diameter.
+   *
+   * Note on point storage: By default, the points are stored in a
+   * std::set, one node being allocated per added point. With a
+   * std::vector as \a TPointContainer, the points are appended to a
+   * flat buffer, whose memory is kept by clear() and reused by the
+   * next plane. Duplicates are then not searched: a point added twice
+   * is stored twice, which changes size() but not the recognized plane.
    *
    * @tparam TSpace specifies the type of digital space in which lies
    * input digital points. A model of CSpace.
@@ -103,10 +114,14 @@ namespace DGtal
    * internal computations. The type should be able to hold integers
    * of order (2*D^3)^2 if D is the diameter of the set of digital
    * points. In practice, diameter is limited to 20 for int32_t,
-   * diameter is approximately 500 for int64_t, and whatever with
+   * diameter is approximately 500 for int64_t, approximately 500000
+   * for int128_t (when WITH_INT128 is defined), and whatever with
    * BigInteger/GMP integers. For huge diameters, the slow-down is
    * polylogarithmic with respect to the diameter.
    *
+   * @tparam TPointContainer the container of the points of the plane,
+   * either a std::set (default) or a std::vector of Point.
+   *
    * Essentially a backport from [ImaGene](https://gforge.liris.cnrs.fr/projects/imagene).
    *
    @code
@@ -125,7 +140,8 @@ namespace DGtal
    * boost::Assignable, boost::ForwardContainer, concepts::CAdditivePrimitiveComputer, concepts::CPointPredicate.
    */
   template < typename TSpace, 
-             typename TInternalInteger >
+             typename TInternalInteger,
+             typename TPointContainer = std::set< typename TSpace::Point > >
   class COBANaivePlaneComputer
   {
 
@@ -137,7 +153,7 @@ namespace DGtal
   public:
     typedef TSpace Space;
     typedef typename Space::Point Point;
-    typedef std::set< Point > PointSet;
+    typedef TPointContainer PointSet;
     typedef typename PointSet::size_type Size;
     typedef typename PointSet::const_iterator ConstIterator;
     typedef typename PointSet::iterator Iterator;
@@ -158,6 +174,7 @@ namespace DGtal
     // ----------------------- internal types ------------------------------
   private:
     typedef PointVector< 3, InternalInteger > InternalPoint3;
+    typedef typename ContainerTraits< PointSet >::Category PointSetCategory;
     typedef SpaceND< 2, InternalInteger > InternalSpace2;
     typedef typename InternalSpace2::Point InternalPoint2;
     typedef LatticePolytope2D< InternalSpace2 > ConvexPolygonZ2;
@@ -550,6 +567,21 @@ namespace DGtal
      */
     void computeGradient( InternalPoint2 & grad, const State & state ) const;
 
+    /**
+     * Stores a point of the plane, in a set or at the end of a vector.
+     * @param p any point.
+     */
+    void insertPoint( const Point & p, SimpleAssociativeCategory );
+    void insertPoint( const Point & p, SequenceCategory );
+
+    /**
+     * @param p any point.
+     * @return 'true' if \a p is known to be stored, always 'false' for
+     * a vector since duplicates are not searched.
+     */
+    bool isStored( const Point & p, SimpleAssociativeCategory ) const;
+    bool isStored( const Point & p, SequenceCategory ) const;
+
   }; // end of class COBANaivePlaneComputer
 
 
@@ -559,9 +591,9 @@ namespace DGtal
    * @param object the object of class 'COBANaivePlaneComputer' to write.
    * @return the output stream after the writing.
    */
-  template <typename TSpace, typename TInternalInteger>
+  template <typename TSpace, typename TInternalInteger, typename TPointContainer>
   std::ostream&
-  operator<< ( std::ostream & out, const COBANaivePlaneComputer<TSpace, TInternalInteger> & object );
+  operator<< ( std::ostream & out, const COBANaivePlaneComputer<TSpace, TInternalInteger, TPointContainer> & object );
 
 } // namespace DGtal
 
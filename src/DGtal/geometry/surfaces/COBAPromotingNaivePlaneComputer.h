@@ -0,0 +1,434 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file COBAPromotingNaivePlaneComputer.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module COBAPromotingNaivePlaneComputer.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(COBAPromotingNaivePlaneComputer_RECURSES)
+#error Recursive header files inclusion detected in COBAPromotingNaivePlaneComputer.h
+#else // defined(COBAPromotingNaivePlaneComputer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define COBAPromotingNaivePlaneComputer_RECURSES
+
+#if !defined COBAPromotingNaivePlaneComputer_h
+/** Prevents repeated inclusion of headers. */
+#define COBAPromotingNaivePlaneComputer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class COBAPromotingNaivePlaneComputer
+  /**
+   * Description of template class 'COBAPromotingNaivePlaneComputer' <p> \brief
+   * Aim: A class that recognizes pieces of digital planes of given
+   * axis width, like COBANaivePlaneComputer, but which chooses its
+   * internal integer type at initialization according to the given
+   * diameter.
+   *
+   * The internal integers of COBANaivePlaneComputer should hold
+   * integers of order (2*D^3)^2 if D is the diameter of the set of
+   * digital points. This class uses a COBANaivePlaneComputer with
+   * the narrowest type that cannot overflow for the diameter given
+   * to \ref init: DGtal::int64_t up to diameter MaxDiameterInt64
+   * (500), DGtal::int128_t (when WITH_INT128 is defined) up to
+   * diameter MaxDiameterInt128 (500000), and DGtal::BigInteger
+   * (when WITH_BIGINTEGER is defined) for greater diameters. If
+   * BigInteger is not available, the widest available type is used
+   * and the recognition may overflow for huge diameters.
+   *
+   * Since int128_t computations stay in registers, they are much
+   * faster than BigInteger ones, so that most plane recognitions on
+   * large coordinates avoid GMP.
+   *
+   * It has the same services as COBANaivePlaneComputer, except
+   * those depending on the internal integer type (ic(),
+   * exactNormal()). It is a model of boost::DefaultConstructible,
+   * boost::CopyConstructible, boost::Assignable,
+   * boost::ForwardContainer, concepts::CAdditivePrimitiveComputer,
+   * concepts::CPointPredicate.
+   *
+   @code
+   typedef SpaceND<3,int> Z3;
+   typedef COBAPromotingNaivePlaneComputer< Z3 > NaivePlaneComputer;
+   NaivePlaneComputer plane;
+   plane.init( 2, 100000, 1, 1 ); // axis is z, diameter is 100000 => int128_t
+   plane.extend( Point( 10, 0, 0 ) ); // return 'true'
+   plane.extend( Point( 0, 8, 0 ) );  // return 'true'
+   plane.extend( Point( 0, 0, 6 ) );  // return 'true'
+   plane.extend( Point( 5, 5, 5 ) );  // return 'false'
+   @endcode
+   *
+   * @tparam TSpace specifies the type of digital space in which lies
+   * input digital points. A model of CSpace.
+   *
+   * @see COBANaivePlaneComputer
+   */
+  template < typename TSpace >
+  class COBAPromotingNaivePlaneComputer
+  {
+
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 3 ));
+
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TSpace Space;
+    typedef typename Space::Point Point;
+    typedef std::set< Point > PointSet;
+    typedef typename PointSet::size_type Size;
+    typedef typename PointSet::const_iterator ConstIterator;
+    typedef typename PointSet::iterator Iterator;
+    typedef DGtal::int64_t Integer;
+    typedef COBANaivePlaneComputer< Space, DGtal::int64_t > COBAComputer64;
+#ifdef WITH_INT128
+    typedef COBANaivePlaneComputer< Space, DGtal::int128_t > COBAComputer128;
+#endif
+#ifdef WITH_BIGINTEGER
+    typedef COBANaivePlaneComputer< Space, DGtal::BigInteger > COBAComputerBig;
+#endif
+    typedef typename COBAComputer64::Primitive Primitive;
+
+    /// The internal integer types, from the narrowest to the widest.
+    enum IntegerLevel { Int64Level, Int128Level, BigIntegerLevel };
+
+    /// Maximal diameter for DGtal::int64_t internal integers.
+    static const Integer MaxDiameterInt64 = 500;
+    /// Maximal diameter for DGtal::int128_t internal integers.
+    static const Integer MaxDiameterInt128 = 500000;
+
+    // ----------------------- std public types ------------------------------
+  public:
+    typedef typename PointSet::const_iterator const_iterator;
+    typedef typename PointSet::const_pointer const_pointer;
+    typedef typename PointSet::const_reference const_reference;
+    typedef typename PointSet::value_type value_type;
+    typedef typename PointSet::difference_type difference_type;
+    typedef typename PointSet::size_type size_type;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~COBAPromotingNaivePlaneComputer();
+
+    /**
+     * Constructor. The object is not valid and should be initialized.
+     * @see init
+     */
+    COBAPromotingNaivePlaneComputer();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    COBAPromotingNaivePlaneComputer ( const COBAPromotingNaivePlaneComputer & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    COBAPromotingNaivePlaneComputer & operator= ( const COBAPromotingNaivePlaneComputer & other );
+
+    /**
+     * @return the internal integer type chosen at the last call to init.
+     */
+    IntegerLevel level() const;
+
+    /**
+     * Clear the object, free memory. The plane keeps its main axis,
+     * diameter and width, but contains no point.
+     */
+    void clear();
+
+    /**
+     * Chooses the narrowest internal integer type for \a diameter,
+     * then initializes the corresponding COBANaivePlaneComputer. Calls
+     * clear so that the object is ready to be extended.
+     *
+     * @param axis the main axis (0,1,2) for x, y or z.
+     *
+     * @param diameter the diameter for the set of points (maximum
+     * distance between the given points)
+     *
+     * @param widthNumerator the maximal axis-width (x,y,or z) for the
+     * plane is defined as the rational number \a widthNumerator / \a
+     * widthDenominator (default is 1/1, i.e. naive plane).
+     *
+     * @param widthDenominator the maximal axis-width (x,y,or z) for
+     * the plane is defined as the rational number \a widthNumerator /
+     * \a widthDenominator (default is 1/1, i.e. naive plane).
+     */
+    void init( Dimension axis, Integer diameter,
+               Integer widthNumerator = NumberTraits< Integer >::ONE,
+               Integer widthDenominator = NumberTraits< Integer >::ONE );
+
+    /**
+     * @return the number of vertices/edges of the convex integer polygon of solutions.
+     */
+    Size complexity() const;
+
+    //-------------------- model of ForwardContainer -----------------------------
+  public:
+
+    /**
+     * @return the number of distinct points in the current naive plane.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' if and only if this object contains no point.
+     */
+    bool empty() const;
+
+    /**
+     * @return a const iterator pointing on the first point stored in the current naive plane.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator pointing after the last point stored in the current naive plane.
+     */
+    ConstIterator end() const;
+
+    /**
+     * NB: std version.
+     * @return the maximal allowed number of points in the current naive plane.
+     * @see maxSize
+     */
+    Size max_size() const;
+
+    /**
+     * same as max_size
+     * @return the maximal allowed number of points in the current naive plane.
+     */
+    Size maxSize() const;
+
+    //-------------------- model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+     * Checks if the point \a p is in the current digital plane.
+     *
+     * @param p any 3D point.
+     *
+     * @return 'true' if it is in the current plane, false otherwise.
+     */
+    bool operator()( const Point & p ) const;
+
+    //-------------------- model of CIncrementalPrimitiveComputer -----------------------------
+  public:
+
+    /**
+     * Adds the point \a p to this plane if it is within the current
+     * bounds. The plane parameters are not updated.
+     *
+     * @param p any 3D point (in the specified diameter).
+     *
+     * @return 'true' if \a p is in the plane, 'false' otherwise (the
+     * object is then in its original state).
+     */
+    bool extendAsIs( const Point & p );
+
+    /**
+     * Adds the point \a p and checks if we have still a digital plane
+     * of specified width. The plane parameters may be updated so as
+     * to include the new point.
+     *
+     * @param p any 3D point (in the specified diameter).
+     *
+     * @return 'true' if it is still a plane, 'false' otherwise (the
+     * object is then in its original state).
+     */
+    bool extend( const Point & p );
+
+    /**
+     * Checks if we have still a digital plane of specified width when
+     * adding point \a p. The object is left unchanged whatever the
+     * returned value.
+     *
+     * @param p any 3D point (in the specified diameter).
+     *
+     * @return 'true' if this is still a plane, 'false' otherwise.
+     */
+    bool isExtendable( const Point & p ) const;
+
+    //-------------------- model of CAdditivePrimitiveComputer -----------------------------
+  public:
+
+    /**
+     * Adds the range of points [\a it, \a itE) and checks if we have
+     * still a digital plane of specified width.
+     *
+     * @tparam TInputIterator any model of InputIterator on Point.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     *
+     * @return 'true' if it is still a plane, 'false' otherwise (the
+     * object is then in its original state).
+     */
+    template <typename TInputIterator>
+    bool extend( TInputIterator it, TInputIterator itE );
+
+    /**
+     * Checks if we have still a digital plane of specified width when
+     * adding the range of points [\a it, \a itE). The object is left
+     * unchanged whatever the returned value.
+     *
+     * @tparam TInputIterator any model of InputIterator on Point.
+     * @param it an iterator on the first element of the range of 3D points.
+     * @param itE an iterator after the last element of the range of 3D points.
+     *
+     * @return 'true' if this is still a plane, 'false' otherwise.
+     */
+    template <typename TInputIterator>
+    bool isExtendable( TInputIterator it, TInputIterator itE ) const;
+
+    //-------------------- Primitive services -----------------------------
+  public:
+
+    /**
+       @return the current primitive recognized by this computer,
+       which is a ParallelStrip of axis width smaller than the one
+       specified at instanciation.
+    */
+    Primitive primitive() const;
+
+    //-------------------- Parameters services -----------------------------
+  public:
+
+    /**
+     * @tparam Vector3D any type T such that T.operator[](int i)
+     * returns a reference to a double. i ranges in 0,1,2.
+     *
+     * @param [in,out] normal (updates) the current normal vector
+     */
+    template <typename Vector3D>
+    void getNormal( Vector3D & normal ) const;
+
+    /**
+     * @tparam Vector3D any type T such that T.operator[](int i)
+     * returns a reference to a double. i ranges in 0,1,2.
+     *
+     * @param normal (updates) the current unit normal vector
+     */
+    template <typename Vector3D>
+    void getUnitNormal( Vector3D & normal ) const;
+
+    /**
+     * If n is the unit normal to the current plane, then n.x >= min
+     * and n.x <= max are the two half-planes defining it.
+     *
+     * @param min the lower bound (corresponding to the unit vector).
+     * @param max the upper bound (corresponding to the unit vector).
+     */
+    void getBounds( double & min, double & max ) const;
+
+    /**
+     * @pre ! empty()
+     * @return the current minimal point of the plane.
+     */
+    const Point & minimalPoint() const;
+
+    /**
+     * @pre ! empty()
+     * @return the current maximal point of the plane.
+     */
+    const Point & maximalPoint() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    IntegerLevel myLevel;          /**< The internal integer type in use. */
+    COBAComputer64 myComputer64;   /**< The plane computer with int64_t integers. */
+#ifdef WITH_INT128
+    COBAComputer128 myComputer128; /**< The plane computer with int128_t integers. */
+#endif
+#ifdef WITH_BIGINTEGER
+    COBAComputerBig myComputerBig; /**< The plane computer with BigInteger integers. */
+#endif
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+  }; // end of class COBAPromotingNaivePlaneComputer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'COBAPromotingNaivePlaneComputer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'COBAPromotingNaivePlaneComputer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const COBAPromotingNaivePlaneComputer<TSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/COBAPromotingNaivePlaneComputer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined COBAPromotingNaivePlaneComputer_h
+
+#undef COBAPromotingNaivePlaneComputer_RECURSES
+#endif // else defined(COBAPromotingNaivePlaneComputer_RECURSES)
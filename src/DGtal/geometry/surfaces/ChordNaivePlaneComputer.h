@@ -45,7 +45,9 @@
 // Inclusions
 #include <iostream>
 #include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
 #include "DGtal/kernel/CSignedNumber.h"
 #include "DGtal/kernel/CSpace.h"
 #include "DGtal/geometry/surfaces/ParallelStrip.h"
@@ -92,6 +94,15 @@ namespace DGtal
    *  sufficient. For greater diameters, it is necessary to use
    *  BigInteger.
 
+   * \par Note on point storage: By default, the points are stored in
+   *  a std::set, one node being allocated per added point, and
+   *  isExtendable() inserts then erases the tested point. With a
+   *  std::vector as \a TInputPointContainer, the points are appended
+   *  to a flat buffer whose memory is kept by clear(), and a tested
+   *  point is simply pushed and popped back. Duplicates are then not
+   *  searched: a point added twice is stored twice, which changes
+   *  size() but not the recognized plane.
+
    * \par What is the best algorithm to check if a set of digital points is some (naive) plane ?
 
    * We discuss only this question between ChordNaivePlaneComputer (1)
@@ -150,10 +161,14 @@ namespace DGtal
    * should be able to hold integers of order \f$(2*D)^2\f$ if D is the
    * diameter of the set of digital points.
 
+   * @tparam TInputPointContainer the container of the points of the
+   * plane, either a std::set (default) or a std::vector of InputPoint.
+
    */
   template < typename TSpace,
              typename TInputPoint,
-             typename TInternalScalar >
+             typename TInternalScalar,
+             typename TInputPointContainer = std::set< TInputPoint > >
   class ChordNaivePlaneComputer
   {
 
@@ -172,7 +187,7 @@ namespace DGtal
     typedef typename InputPoint::Coordinate Coordinate;
     typedef PointVector<3,InternalScalar> InternalVector;
 
-    typedef std::set< InputPoint > InputPointSet;
+    typedef TInputPointContainer InputPointSet;
     typedef typename InputPointSet::size_type Size;
     typedef typename InputPointSet::const_iterator ConstIterator;
     typedef typename InputPointSet::iterator Iterator;
@@ -190,6 +205,7 @@ namespace DGtal
 
     // ----------------------- internal types ------------------------------
   private:
+    typedef typename ContainerTraits< InputPointSet >::Category InputPointSetCategory;
     /**
        Defines the state of the algorithm, the part of the data that
        may change after initialization of the ChordNaivePlaneComputer
@@ -781,6 +797,30 @@ namespace DGtal
      */
     void selfDisplay ( std::ostream & out, const State & state ) const;
 
+    /**
+       Stores a point of the plane, in a set or at the end of a vector.
+       @param p any point.
+    */
+    void insertPoint( const InputPoint & p, SimpleAssociativeCategory ) const;
+    void insertPoint( const InputPoint & p, SequenceCategory ) const;
+
+    /**
+       Removes the point that was stored last.
+       @param p the point given to the last call to insertPoint.
+    */
+    void removePoint( const InputPoint & p, SimpleAssociativeCategory ) const;
+    void removePoint( const InputPoint & p, SequenceCategory ) const;
+
+    /**
+       Stores the points of a range.
+       @tparam TInputIterator any model of InputIterator on InputPoint.
+       @param[in] itB an iterator on the first element of the range of 3D points.
+       @param[in] itE an iterator after the last element of the range of 3D points.
+    */
+    template <typename TInputIterator>
+    void insertPoints( TInputIterator itB, TInputIterator itE, SimpleAssociativeCategory ) const;
+    template <typename TInputIterator>
+    void insertPoints( TInputIterator itB, TInputIterator itE, SequenceCategory ) const;
 
   }; // end of class ChordNaivePlaneComputer
 
@@ -791,10 +831,10 @@ namespace DGtal
    * @param object the object of class 'ChordNaivePlaneComputer' to write.
    * @return the output stream after the writing.
    */
-  template <typename TSpace, typename TInputPoint, typename TInternalScalar>
+  template <typename TSpace, typename TInputPoint, typename TInternalScalar, typename TInputPointContainer>
   std::ostream&
   operator<< ( std::ostream & out,
-               const ChordNaivePlaneComputer<TSpace, TInputPoint, TInternalScalar> & object );
+               const ChordNaivePlaneComputer<TSpace, TInputPoint, TInternalScalar, TInputPointContainer> & object );
 
 } // namespace DGtal
 
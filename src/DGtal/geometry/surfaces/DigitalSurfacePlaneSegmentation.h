@@ -0,0 +1,338 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSurfacePlaneSegmentation.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DigitalSurfacePlaneSegmentation.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSurfacePlaneSegmentation_RECURSES)
+#error Recursive header files inclusion detected in DigitalSurfacePlaneSegmentation.h
+#else // defined(DigitalSurfacePlaneSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSurfacePlaneSegmentation_RECURSES
+
+#if !defined DigitalSurfacePlaneSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSurfacePlaneSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSurfacePlaneSegmentation
+  /**
+   * Description of template class 'DigitalSurfacePlaneSegmentation' <p>
+   * \brief Aim: Segments a digital surface into pieces of digital
+   * planes, i.e. computes a partition of its surfels such that the
+   * inner voxels of the surfels of each piece belong to a digital
+   * plane recognized by a plane computer (e.g. COBANaivePlaneComputer
+   * or ChordNaivePlaneComputer).
+   *
+   * The segmentation is greedy: the seeds (all the surfels, in a given
+   * order) are taken one after the other and, if a seed does not
+   * belong to a piece yet, a new piece grows from it by a
+   * breadth-first traversal of the surfels that do not belong to any
+   * piece, as long as the plane computer accepts their inner voxels
+   * (see example greedy-plane-segmentation.cpp).
+   *
+   * The surfels, their inner voxels and their adjacencies are first
+   * stored in arrays, where each surfel is identified by its index.
+   * Then the pieces grow by rounds: the pieces of the next unassigned
+   * seeds grow concurrently, without seeing each other, and are
+   * accepted in the order of their seeds until one of them contains a
+   * surfel of a piece accepted in the same round. The next round
+   * starts from the first rejected seed. Since an accepted piece is
+   * exactly the one that would have grown after the previous pieces,
+   * the segmentation does not depend on the number of threads.
+   *
+   * When consecutive seeds are close to each other, like in the
+   * default order of the surfels, the piece of a seed often contains
+   * the next seeds and few pieces grow concurrently. Spreading the
+   * seeds with setSeedOrder(), e.g. by shuffling them, gives more
+   * pieces per round.
+   *
+   * @code
+   typedef COBANaivePlaneComputer<Z3, DGtal::int64_t> PlaneComputer;
+   DigitalSurfacePlaneSegmentation<MyDigitalSurface, PlaneComputer> segmentation( surface );
+   segmentation.compute( PlaneInitializer() ); // calls plane.init( axis, 500, 1, 1 )
+   for ( Index i = 0; i < segmentation.size(); ++i )
+     ... segmentation.surfel( i ) belongs to piece segmentation.label( i )
+   * @endcode
+   *
+   * @tparam TDigitalSurface any model of DigitalSurface.
+   * @tparam TPlaneComputer any model of CAdditivePrimitiveComputer
+   * whose points are the points of the digital space.
+   *
+   * @see COBANaivePlaneComputer ChordNaivePlaneComputer testDigitalSurfacePlaneSegmentation.cpp
+   */
+  template <typename TDigitalSurface, typename TPlaneComputer>
+  class DigitalSurfacePlaneSegmentation
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TDigitalSurface DigitalSurface;
+    typedef TPlaneComputer PlaneComputer;
+    typedef typename DigitalSurface::KSpace KSpace;
+    typedef typename DigitalSurface::Surfel Surfel;
+    typedef typename DigitalSurface::DigitalSurfaceTracker DigitalSurfaceTracker;
+    typedef typename KSpace::Point Point;
+    typedef std::size_t Index;
+    typedef std::size_t Size;
+    /// Iterator on the indices of the surfels of a piece.
+    typedef typename std::vector<Index>::const_iterator ConstIterator;
+
+    /// Index of no surfel or of no piece.
+    static const Index InvalidIndex = (Index) -1;
+    /// Maximal number of neighbors of a surfel.
+    static const Dimension MaxNbNeighbors = 2 * ( KSpace::dimension - 1 );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Stores the surfels of @a aSurface, their inner
+     * voxels and their adjacencies (in parallel with OpenMP). The
+     * seeds are all the surfels, in the order of @a aSurface.
+     *
+     * @param aSurface the digital surface (aliased).
+     */
+    DigitalSurfacePlaneSegmentation( ConstAlias<DigitalSurface> aSurface );
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSurfacePlaneSegmentation();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the number of surfels.
+     */
+    Size size() const;
+
+    /**
+     * @param i the index of a surfel.
+     * @return the surfel of index @a i.
+     */
+    const Surfel & surfel( const Index i ) const;
+
+    /**
+     * @param s any surfel.
+     * @return the index of @a s, or InvalidIndex if it is not a surfel
+     * of the digital surface (logarithmic time).
+     */
+    Index index( const Surfel & s ) const;
+
+    /**
+     * @param i the index of a surfel.
+     * @return the inner voxel of the surfel of index @a i, given to
+     * the plane computers.
+     */
+    const Point & point( const Index i ) const;
+
+    /**
+     * Sets the order in which the surfels are taken as seeds.
+     * @param someSeeds the indices of all the surfels, in any order.
+     */
+    void setSeedOrder( const std::vector<Index> & someSeeds );
+
+    /**
+     * @return the indices of the surfels, in the order in which they
+     * are taken as seeds.
+     */
+    const std::vector<Index> & seedOrder() const;
+
+    /**
+     * Computes the segmentation, forgetting the previous one.
+     *
+     * @tparam PlaneInitializer the type of a functor initializing a
+     * plane computer for a seed, with the signature
+     * `void operator()( PlaneComputer & plane, Dimension axis ) const`,
+     * where @a axis is the orthogonal direction of the seed, e.g.
+     * calling `plane.init( axis, diameter, widthNum, widthDen )`. It is
+     * called concurrently.
+     *
+     * @param anInitializer the plane initializer.
+     *
+     * @param nbSeedsPerRound the number of pieces that grow
+     * concurrently, or 0 for four times the number of threads (one
+     * piece at a time without OpenMP).
+     */
+    template <typename PlaneInitializer>
+    void compute( const PlaneInitializer & anInitializer,
+                  unsigned int nbSeedsPerRound = 0 );
+
+    /**
+     * @return the number of pieces of the segmentation.
+     */
+    Size nbPlanes() const;
+
+    /**
+     * @param i the index of a surfel.
+     * @return the index of the piece of the surfel of index @a i, or
+     * InvalidIndex if the plane computer of its seed has rejected it.
+     */
+    Index label( const Index i ) const;
+
+    /**
+     * @return the index of the piece of each surfel.
+     */
+    const std::vector<Index> & labels() const;
+
+    /**
+     * @param k the index of a piece.
+     * @return the plane computer that has recognized the piece @a k.
+     */
+    const PlaneComputer & plane( const Index k ) const;
+
+    /**
+     * @param k the index of a piece.
+     * @return an iterator on the index of the first surfel of piece @a
+     * k, its seed. The surfels are in the order of the traversal.
+     */
+    ConstIterator begin( const Index k ) const;
+
+    /**
+     * @param k the index of a piece.
+     * @return an iterator after the index of the last surfel of piece @a k.
+     */
+    ConstIterator end( const Index k ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// the digital surface.
+    const DigitalSurface* mySurface;
+    /// the surfels, in the order of the digital surface.
+    std::vector<Surfel> mySurfels;
+    /// the (surfel, index) pairs sorted by surfel.
+    std::vector< std::pair<Surfel, Index> > mySortedSurfels;
+    /// the inner voxel of each surfel.
+    std::vector<Point> myPoints;
+    /// the orthogonal direction of each surfel.
+    std::vector<Dimension> myAxes;
+    /// the neighbors of each surfel, MaxNbNeighbors per surfel.
+    std::vector<Index> myNeighbors;
+    /// the number of neighbors of each surfel.
+    std::vector<unsigned char> myNbNeighbors;
+    /// the order of the seeds.
+    std::vector<Index> mySeeds;
+    /// the piece of each surfel.
+    std::vector<Index> myLabels;
+    /// the plane computer of each piece.
+    std::vector<PlaneComputer> myPlanes;
+    /// the surfels of all the pieces, piece after piece.
+    std::vector<Index> myPlaneSurfels;
+    /// the position in myPlaneSurfels of the first surfel of each piece (and the total).
+    std::vector<Index> myPlaneOffsets;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    DigitalSurfacePlaneSegmentation ( const DigitalSurfacePlaneSegmentation & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    DigitalSurfacePlaneSegmentation & operator= ( const DigitalSurfacePlaneSegmentation & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Grows a piece from a seed among the surfels without piece,
+     * by a breadth-first traversal.
+     *
+     * @param plane (modified) an initialized plane computer, extended
+     * by the inner voxels of the piece.
+     * @param seed the index of the seed.
+     * @param surfels (modified) the indices of the surfels of the
+     * piece, in the order of the traversal.
+     * @param marks (modified) the mark of each surfel, set to @a mark
+     * when it is reached.
+     * @param mark a value that is not in @a marks before the call.
+     */
+    void grow( PlaneComputer & plane, const Index seed,
+               std::vector<Index> & surfels,
+               std::vector<unsigned int> & marks, const unsigned int mark ) const;
+
+  }; // end of class DigitalSurfacePlaneSegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSurfacePlaneSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSurfacePlaneSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurface, typename TPlaneComputer>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSurfacePlaneSegmentation<TDigitalSurface, TPlaneComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/DigitalSurfacePlaneSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSurfacePlaneSegmentation_h
+
+#undef DigitalSurfacePlaneSegmentation_RECURSES
+#endif // else defined(DigitalSurfacePlaneSegmentation_RECURSES)
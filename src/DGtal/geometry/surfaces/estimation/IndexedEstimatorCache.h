@@ -0,0 +1,378 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IndexedEstimatorCache.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module IndexedEstimatorCache.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IndexedEstimatorCache_RECURSES)
+#error Recursive header files inclusion detected in IndexedEstimatorCache.h
+#else // defined(IndexedEstimatorCache_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IndexedEstimatorCache_RECURSES
+
+#if !defined IndexedEstimatorCache_h
+/** Prevents repeated inclusion of headers. */
+#define IndexedEstimatorCache_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
+#include "DGtal/geometry/surfaces/estimation/CSurfelLocalEstimator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IndexedEstimatorCache
+  /**
+   * Description of template class 'IndexedEstimatorCache' <p>
+   * \brief Aim: this class adapts any local surface estimator to cache the
+   * estimated values in a contiguous array, each surfel being given a
+   * dense index (its rank in the range given at initialization).
+   *
+   * Contrary to EstimatorCache, which stores a (Surfel, Quantity) pair
+   * per node of an associative container, values are stored in a
+   * std::vector<Quantity> and surfels are mapped to their index by a
+   * hash table. Evaluation by index (see evalAt()) is thus a single
+   * array access, and evaluation by surfel a single hash lookup.
+   *
+   * If the estimator eval() method is thread-safe, the cache may be
+   * filled in parallel (see the @a parallelFill parameter of the
+   * constructor) when DGtal has been built with OpenMP support
+   * (WITH_OPENMP flag set to "true"). This is the case of
+   * TrueDigitalSurfaceLocalEstimator on an ImplicitPolynomial3Shape,
+   * but not of the integral invariant estimators, whose functors use
+   * mutable temporaries.
+   *
+   * This class is a model of concepts::CSurfelLocalEstimator.
+   *
+   * @see testEstimatorCache.cpp
+   *
+   * @tparam TEstimator any model of CSurfelLocalEstimator whose Surfel
+   * type is hashable with std::hash (e.g. KhalimskyCell or
+   * SignedKhalimskyCell).
+   */
+  template <typename TEstimator>
+  class IndexedEstimatorCache
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    ///Estimator type
+    typedef TEstimator Estimator;
+    BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<TEstimator> ));
+
+    ///Surfel type
+    typedef typename Estimator::Surfel Surfel;
+
+    ///Quantity type
+    typedef typename Estimator::Quantity Quantity;
+
+    ///Index type
+    typedef std::size_t Index;
+
+    ///Self
+    typedef IndexedEstimatorCache<Estimator> Self;
+
+    /**
+     * Default constructor.
+     */
+    IndexedEstimatorCache(): myEstimator(0), myParallelFill(false), myInit(false)
+    {}
+
+    /**
+     * Constructor from estimator instance.
+     *
+     * @param anEstimator the estimator to cache (aliased).
+     * @param parallelFill when 'true', init() evaluates the estimator
+     * in parallel (with OpenMP). Only use it if the estimator
+     * eval(iterator) method is thread-safe.
+     */
+    IndexedEstimatorCache( Alias<Estimator> anEstimator,
+                           bool parallelFill = false )
+      : myEstimator(&anEstimator), myParallelFill(parallelFill), myInit(false)
+    {}
+
+    /**
+     * Destructor.
+     */
+    ~IndexedEstimatorCache()
+    {}
+
+    /**
+     * Copy constructor.
+     */
+    IndexedEstimatorCache(const Self &other) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator= ( const Self & other ) = default;
+
+    // ----------------------- CSurfelLocalEstimator Interface --------------------------------------
+
+    /**
+     * Estimator initialization. This method initializes the underlying
+     * estimator and caches all estimated quantity between @a itb and
+     * @a ite. The i-th surfel of the range is given the index i.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param[in] aH the gridstep
+     * @param[in] itb iterator on the first surfel of the surface.
+     * @param[in] ite iterator after the last surfel of the surface.
+     *
+     */
+    template <typename SurfelConstIterator>
+    void init(const double aH, SurfelConstIterator itb, SurfelConstIterator ite)
+    {
+      ASSERT(myEstimator);
+      myEstimator->init(aH,itb,ite);
+
+      //SurfelConstIterator models are usually SinglePass, so the
+      //surfels are first copied into a random access container.
+      mySurfels.clear();
+      for(SurfelConstIterator it = itb; it != ite; ++it)
+        mySurfels.push_back( *it );
+
+      myIndices.clear();
+      myIndices.reserve( mySurfels.size() );
+      for(Index i = 0; i < mySurfels.size(); ++i)
+        myIndices.insert( std::make_pair( mySurfels[ i ], i ) );
+
+      myValues.clear();
+      myValues.resize( mySurfels.size() );
+      const long n = (long) mySurfels.size();
+      if ( myParallelFill )
+        {
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+          for(long i = 0; i < n; ++i)
+            myValues[ i ] = myEstimator->eval( mySurfels.cbegin() + i );
+        }
+      else
+        for(long i = 0; i < n; ++i)
+          myValues[ i ] = myEstimator->eval( mySurfels.cbegin() + i );
+
+      myInit = true;
+    }
+
+    /**
+     * Cached evaluation of the estimator at iterator @a it
+     *
+     * @pre init() method must have been called first.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param [in] it the iterator to the surfel to estimate.
+     * @return the estimated quantity.
+     */
+    template <typename SurfelConstIterator>
+    Quantity eval(const SurfelConstIterator it) const
+    {
+      return this->eval( Surfel( *it ) );
+    }
+
+    /**
+     * Cached evaluation of the estimator at a surfel @a s
+     *
+     * @pre init() method must have been called first.
+     *
+     * @param [in] s the surfel to estimate.
+     * @return the estimated quantity.
+     */
+    Quantity eval(const Surfel s) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      return myValues[ index( s ) ];
+    }
+
+    /**
+     * Cached evaluation of the estimator at the surfel of index @a i,
+     * i.e. a single array access.
+     *
+     * @pre init() method must have been called first.
+     *
+     * @param [in] i any index between 0 and size()-1.
+     * @return the estimated quantity.
+     */
+    const Quantity & evalAt(const Index i) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      ASSERT( i < myValues.size() );
+      return myValues[ i ];
+    }
+
+    /**
+     * Cached range evaluation of the estimator between @a itb
+     * and @a ite.
+     *
+     * @pre init() method must have been called first.
+     *
+     * @tparam  SurfelConstIterator a const iterator on surfels.
+     * @param [in] itb the begin iterator to the surfel to estimate.
+     * @param [in] ite the end iterator to the surfel to estimate.
+     * @param [in] result an output iterator on the result.
+     * @return the estimated quantity.
+     */
+    template <typename SurfelConstIterator,typename OutputIterator>
+    OutputIterator eval(SurfelConstIterator itb,
+                        SurfelConstIterator ite,
+                        OutputIterator result ) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      for(SurfelConstIterator it = itb; it != ite; ++it)
+        *result++ = this->eval(it);
+
+      return result;
+    }
+
+    /**
+     * @return the gridstep.
+     *
+     * @pre init() method must have been called first.
+     */
+    double h() const
+    {
+      return myEstimator->h();
+    }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @pre init() method must have been called first.
+     * @param [in] s any surfel given at initialization.
+     * @return the index of surfel @a s.
+     */
+    Index index( const Surfel & s ) const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      typename std::unordered_map<Surfel, Index>::const_iterator it = myIndices.find( s );
+      ASSERT( it != myIndices.end() );
+      return it->second;
+    }
+
+    /**
+     * @pre init() method must have been called first.
+     * @param [in] i any index between 0 and size()-1.
+     * @return the surfel of index @a i.
+     */
+    const Surfel & surfel( const Index i ) const
+    {
+      ASSERT( i < mySurfels.size() );
+      return mySurfels[ i ];
+    }
+
+    /**
+     * @return the array of all cached values, indexed as the surfels.
+     */
+    const std::vector<Quantity> & values() const
+    {
+      return myValues;
+    }
+
+    /**
+     * @pre init() method must have been called first.
+     * @return the number of cached elements.
+     */
+    Index size() const
+    {
+      ASSERT_MSG(myInit, " init() method must have been called first.");
+      return myValues.size();
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out<< "[IndexedEstimatorCache] number of surfels="<<myValues.size();
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return myEstimator && myEstimator->isValid();
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    ///Alias of the estimator
+    Estimator *myEstimator;
+
+    ///Cached surfels, in the order given at initialization
+    std::vector<Surfel> mySurfels;
+
+    ///Cached values, indexed as mySurfels
+    std::vector<Quantity> myValues;
+
+    ///Map surfel -> index in mySurfels
+    std::unordered_map<Surfel, Index> myIndices;
+
+    ///When 'true', the cache is filled in parallel
+    bool myParallelFill;
+
+    ///Init flag
+    bool myInit;
+
+  }; // end of class IndexedEstimatorCache
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IndexedEstimatorCache'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IndexedEstimatorCache' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename T>
+  std::ostream&
+  operator<< ( std::ostream & out, const IndexedEstimatorCache<T> & object )
+  {
+    object.selfDisplay( out );
+    return out;
+  }
+
+} // namespace DGtal
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IndexedEstimatorCache_h
+
+#undef IndexedEstimatorCache_RECURSES
+#endif // else defined(IndexedEstimatorCache_RECURSES)
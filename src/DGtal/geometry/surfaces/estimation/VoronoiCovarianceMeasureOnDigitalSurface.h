@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <mutex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedConstPtrOrConstPtr.h"
 #include "DGtal/kernel/Point2ScalarFunctors.h"
@@ -67,6 +68,11 @@ namespace DGtal
    * diagonalisation of the VCM, and the orientation of the first VCM
    * eigenvector toward the interior of the surface.
    *
+   * The chi_r VCM of each point is stored in an array with the same
+   * indices as VoronoiCovarianceMeasure::sites. If DGtal has been built
+   * with OpenMP support (WITH_OPENMP flag set to "true"), the chi_r
+   * VCMs are integrated and diagonalized in parallel.
+   *
    * @note Documentation in \ref moduleVCM_sec3_1.
    *
    * @see VoronoiCovarianceMeasure
@@ -104,6 +110,7 @@ namespace DGtal
     typedef EigenDecomposition<KSpace::dimension,Scalar> LinearAlgebraTool;  ///< diagonalizer (nD).
     typedef typename VCM::VectorN                   VectorN;  ///< n-dimensional R-vector
     typedef typename VCM::MatrixNN                 MatrixNN;  ///< nxn R-matrix
+    typedef typename VCM::Index                       Index;  ///< the index of a point
 
     BOOST_CONCEPT_ASSERT(( concepts::CUnaryFunctor<KernelFunction, Point, Scalar> ));
 
@@ -191,11 +198,22 @@ namespace DGtal
     /// @return a const-reference to the map Surfel -> Normals (vcm and trivial normal).
     const Surfel2Normals& mapSurfel2Normals() const;
 
-    /// @return a const-reference to the map Point ->
-    /// EigenStructure of the chi_r VCM (eigenvalues and
-    /// eigenvectors).
+    /// @return the map Point -> EigenStructure of the chi_r VCM
+    /// (eigenvalues and eigenvectors).
+    /// @note the map is built from \ref points and \ref chiVCMs on the
+    /// first call, then kept. Prefer \ref points and \ref chiVCMs,
+    /// which need no extra storage. Concurrent calls are safe: the
+    /// map is built under a lock.
     const Point2EigenStructure& mapPoint2ChiVCM() const;
 
+    /// @return the embedded points of the surface, sorted. The i-th
+    /// point has index i.
+    const std::vector<Point>& points() const;
+
+    /// @return the EigenStructure of the chi_r VCM of each point, with
+    /// the same indices as \ref points.
+    const std::vector<EigenStructure>& chiVCMs() const;
+
     /**
        Gets the eigenvalues of the chi_r VCM at surfel \a s sorted from lowest to highest.
        @param[out] values the eigenvalues of the chi_r VCM at \a s.
@@ -243,8 +261,13 @@ namespace DGtal
     /// used for finding the correct orientation inside/outside for
     /// the VCM.
     Scalar myRadiusTrivial;
-    /// Stores for each point p its convolved VCM, i.e. VCM( chi_r( p ) )
-    Point2EigenStructure myPt2EigenStructure;
+    /// Stores for each point p its convolved VCM, i.e. VCM( chi_r( p ) ),
+    /// with the same indices as myVCM.sites().
+    std::vector<EigenStructure> myEigenStructures;
+    /// The map Point -> EigenStructure, built lazily by mapPoint2ChiVCM.
+    mutable Point2EigenStructure myPoint2ChiVCM;
+    /// Protects the lazy construction of myPoint2ChiVCM.
+    mutable std::mutex myPoint2ChiVCMMutex;
     /// Stores for each surfel its vcm normal and its trivial normal.
     Surfel2Normals mySurfel2Normals;
 
@@ -280,6 +303,13 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       @param[in] p any point.
+       @param[out] i the index of \a p in \ref points, if found.
+       @return 'true' if \a p is one of the points.
+    */
+    bool findPoint( const Point& p, Index& i ) const;
+
   }; // end of class VoronoiCovarianceMeasureOnDigitalSurface
 
 
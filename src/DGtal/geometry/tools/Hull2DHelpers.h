@@ -357,6 +357,54 @@ namespace DGtal
 				   OutputIterator res, 
 				   const Predicate& aPredicate ); 
 
+    /**
+     * @brief Procedure that retrieves the vertices
+     * of the hull of a set of 2D points given by 
+     * the range [ @a itb , @a ite ), like Hull2D::andrewConvexHullAlgorithm,
+     * but with several threads (if OpenMP is available) for large sets
+     * of points:
+     * - first, the points that are strictly inside the polygon whose
+     * vertices are extremal along the axes are discarded
+     * [Akl and Toussaint, 1978], in parallel chunks.
+     * - then, the remaining points are sorted along the horizontal axis
+     * by sorting and merging the chunks in parallel.
+     * - then, the lower and upper convex hulls of each chunk are computed
+     * by a simple Graham scan in parallel and the lower and upper
+     * convex hulls of the whole set are computed by a Graham scan
+     * on these sub-hulls.
+     *
+     * Since an orientation functor stores the points given to
+     * its method init, it cannot be shared by several threads:
+     * it is copied for each chunk and adapted with 
+     * PredicateFromOrientationFunctor2, whose default behavior is to
+     * return 'true' for strictly positive functor values. The points 
+     * are only compared with these predicates, so that the result is
+     * exactly the same as the one of Hull2D::andrewConvexHullAlgorithm
+     * with such a predicate, provided that the orientation functor
+     * is exact. 
+     *
+     * @see Hull2D::andrewConvexHullAlgorithm
+     *
+     * @param itb begin iterator
+     * @param ite end iterator 
+     * @param res output iterator used to export the retrieved points
+     * @param aFunctor any orientation functor
+     * @param nbChunks number of chunks processed in parallel (the
+     * maximal number of OpenMP threads if 0, default value). 
+     * 
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * @tparam OutputIterator a model of incrementable and writable iterator   
+     * @tparam OrientationFunctor a model of COrientationFunctor2
+     */
+    template <typename ForwardIterator, 
+	      typename OutputIterator, 
+	      typename OrientationFunctor >
+    void parallelAndrewConvexHullAlgorithm(const ForwardIterator& itb, 
+					   const ForwardIterator& ite,  
+					   OutputIterator res, 
+					   const OrientationFunctor& aFunctor,
+					   unsigned int nbChunks = 0 ); 
+
 
     /**
      *  @brief Procedure to compute the convex hull thickness given
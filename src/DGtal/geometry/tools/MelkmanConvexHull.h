@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Alias.h"
 #include "DGtal/base/CountedConstPtrOrConstPtr.h"
@@ -67,7 +69,10 @@ namespace DGtal
    *
    * This algorithm is based on a deque, which stores the vertices 
    * of the convex hull (for convenience, the first and last vertex 
-   * contained in the deque are the same point). Since we assume 
+   * contained in the deque are the same point). The deque is stored
+   * in a vector with free room at both ends, so that adding points
+   * does not allocate memory once the vector is large enough, and
+   * the vertices are contiguous. Since we assume 
    * that the input points form a simple polygonal line, a new point
    * cannot be located in the cone formed by the first and last edges
    * of the current convex hull. As a consequence, it is enough to update
@@ -77,6 +82,11 @@ namespace DGtal
    *
    * @see functions::Hull2D::updateHullWithAdaptedStack
    * 
+   * The changes made by the last call to add() are recorded, so
+   * that they can be undone in time proportional to their number
+   * by cancelLastAdd(), which is useful for on-line recognition 
+   * algorithms that try to add a point (see AlphaThickSegmentComputer).
+   * 
    * Note that if the input points do not form a simple polygonal line, 
    * the behavior is not defined. 
    *
@@ -120,13 +130,20 @@ namespace DGtal
     /**
      * Type of iterator on the convex hull vertices
      */
-    typedef typename std::deque<Point>::const_iterator ConstIterator; 
+    typedef typename std::vector<Point>::const_iterator ConstIterator; 
 
     // ----------------------- Standard services ------------------------------
   public:
 
     MelkmanConvexHull( Alias<Functor> aFunctor); 
     MelkmanConvexHull(); 
+
+    /**
+     * Copy constructor. As after an assignment, cancelLastAdd() can
+     * not be called on the copy before the next call to add().
+     * @param mch the object to copy.
+     */
+    MelkmanConvexHull( const Self & mch );
     
     // ----------------------- Interface --------------------------------------
   public:
@@ -136,8 +153,17 @@ namespace DGtal
      * @param aPoint an extra point
      * @post if @a aPoint lies outside the current convex hull, 
      * this hull is then updated with @a aPoint as a vertex. 
+     * @return 'true' if the convex hull has been updated, 
+     * 'false' otherwise.
      */
-    void add ( const Point& aPoint );
+    bool add ( const Point& aPoint );
+
+    /**
+     * Restores the convex hull as it was before the last call to add(). 
+     * @pre add() has been called and neither clear(), reverse() nor
+     * cancelLastAdd() have been called since then.
+     */
+    void cancelLastAdd ();
 
     /**
      * Begin iterator
@@ -199,14 +225,67 @@ namespace DGtal
      **/
     void reverse();
 
+    // ----------------------- Internal types --------------------------------
+  private:
+
+    /**
+     * Elementary changes of the container.
+     */
+    enum Change { PushBack, PopBack, PushFront, PopFront };
+
+    /**
+     * Stack adapters on both ends of the container, as models of
+     * CStack used by functions::Hull2D::updateHullWithAdaptedStack.
+     */
+    struct BackStack
+    {
+      typedef TPoint value_type;
+      typedef unsigned int size_type;
+      BackStack( Self& aHull ) : myHull( &aHull ) {}
+      size_type size() const { return myHull->myBack - myHull->myFront; }
+      bool empty() const { return size() == 0; }
+      Point& top() { return myHull->myContainer[ myHull->myBack - 1 ]; }
+      const Point& top() const { return myHull->myContainer[ myHull->myBack - 1 ]; }
+      void push( const Point& aPoint ) { myHull->pushBack( aPoint ); }
+      void pop() { myHull->popBack(); }
+      Self* myHull;
+    };
+    struct FrontStack
+    {
+      typedef TPoint value_type;
+      typedef unsigned int size_type;
+      FrontStack( Self& aHull ) : myHull( &aHull ) {}
+      size_type size() const { return myHull->myBack - myHull->myFront; }
+      bool empty() const { return size() == 0; }
+      Point& top() { return myHull->myContainer[ myHull->myFront ]; }
+      const Point& top() const { return myHull->myContainer[ myHull->myFront ]; }
+      void push( const Point& aPoint ) { myHull->pushFront( aPoint ); }
+      void pop() { myHull->popFront(); }
+      Self* myHull;
+    };
+
 
     // ------------------------- Private Datas --------------------------------
   private:
     /**
-     * Deque container, which stores the vertices of the convex hull
+     * Container, which stores the vertices of the convex hull
+     * in the range of indices [myFront, myBack).
      * NB: the first and last point is the same. 
      */
-    std::deque<Point> myContainer; 
+    std::vector<Point> myContainer; 
+    /**
+     * Index of the first vertex in myContainer
+     */
+    unsigned int myFront;
+    /**
+     * Index after the last vertex in myContainer
+     */
+    unsigned int myBack;
+    /**
+     * Changes of the container made by the last call to add(), 
+     * with the removed points
+     */
+    std::vector< std::pair<Change, Point> > myLastChanges;
     /**
      * Predicate devoted to the backward scan
      */
@@ -223,9 +302,41 @@ namespace DGtal
      * first point used to reverse the convexhull container.
      **/
     Point myFirstPoint; 
+    /**
+     * first point before the last call to add().
+     **/
+    Point myPreviousFirstPoint; 
 
     // ------------------------- Internals ------------------------------------
   private:
+
+    /**
+     * Adds a point at the back of the container.
+     * @param aPoint the point to add (not a reference to a point of the container).
+     */
+    void pushBack( const Point& aPoint );
+
+    /**
+     * Removes the point at the back of the container.
+     */
+    void popBack();
+
+    /**
+     * Adds a point at the front of the container.
+     * @param aPoint the point to add (not a reference to a point of the container).
+     */
+    void pushFront( const Point& aPoint );
+
+    /**
+     * Removes the point at the front of the container.
+     */
+    void popFront();
+
+    /**
+     * Moves the points of the container so that there is free room at
+     * both ends, enlarging the container if needed.
+     */
+    void makeRoom();
     
   }; // end of class MelkmanConvexHull
 
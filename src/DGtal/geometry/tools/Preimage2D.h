@@ -41,9 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
-#include <list>
+#include <deque>
 #include "DGtal/base/Common.h"
-#include "DGtal/base/OpInSTLContainers.h"
 #include "DGtal/shapes/fromPoints/Point2ShapePredicate.h"
 #include "DGtal/io/Color.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -77,6 +76,12 @@ namespace DGtal
    * will return the right output.
    *
    * @tparam Shape  a model of COrientableHypersurface
+   * @tparam TContainer  the container of the vertices of the two parts
+   * of the preimage, a model of boost::FrontInsertionSequence and
+   * boost::BackInsertionSequence with reversible iterators (default
+   * is std::deque, whose vertices are stored in contiguous blocks;
+   * std::list is also a model). The vertices are only added or
+   * removed at both ends.
    *
    * You can define your preimage type from a given shape type as follows:
    * @snippet geometry/tools/examplePreimage.cpp PreimageTypedefFromStraightLine
@@ -89,7 +94,8 @@ namespace DGtal
    *
    * @see examplePreimage.cpp testPreimage.cpp
    */
-  template <typename Shape>
+  template <typename Shape,
+            typename TContainer = std::deque<typename Shape::Point> >
   class Preimage2D
   {
 
@@ -100,16 +106,16 @@ namespace DGtal
     typedef typename Shape::Point Point;
     typedef typename Shape::Point Vector;
     //container of points
-    typedef std::list<Point> Container;
+    typedef TContainer Container;
     
 
   private:
 
     //Iterators on the container
-    typedef typename std::list<Point>::iterator ForwardIterator;
-    typedef typename std::list<Point>::reverse_iterator BackwardIterator;
-    typedef typename std::list<Point>::const_iterator ConstForwardIterator;
-    typedef typename std::list<Point>::const_reverse_iterator ConstBackwardIterator;
+    typedef typename Container::iterator ForwardIterator;
+    typedef typename Container::reverse_iterator BackwardIterator;
+    typedef typename Container::const_iterator ConstForwardIterator;
+    typedef typename Container::const_reverse_iterator ConstBackwardIterator;
 
     //Predicates used to decide whether the preimage
     //has to be updated or not
@@ -399,26 +405,38 @@ namespace DGtal
   private:
 
     /**
-     * Updates the current preimage
+     * Updates the current preimage by removing the first
+     * vertices of a container, as long as the shape going
+     * through the two first vertices satisfies the predicate
+     * for a new vertex.
      *
      * Nb: in O(n)
      *
      * @param aPoint  a new vertex of the preimage,
-     * @param aContainer  the STL-like container to be updated,
-     * @param anIterator  an iterator to its front (resp. back)
-     * @param anEndIterator  an iterator pointing after its back 
-     * (resp. before its front). 
+     * @param aContainer  the container to be updated (myPHull or myQHull).
      *
-     * @tparam Iterator  the type of Iterator (either Container::iterator or Container::reverse_iterator)
      * @tparam Predicate  the type of Predicate
      */
-    template <typename Iterator, typename Predicate>
-    void update(const Point & aPoint, 
-                Container & aContainer,
-                Iterator & anIterator,
-                const Iterator & anEndIterator);
-
+    template <typename Predicate>
+    void updateFront(const Point & aPoint,
+                     Container & aContainer);
 
+    /**
+     * Updates the current preimage by removing the last
+     * vertices of a container, as long as the shape going
+     * through the two last vertices satisfies the predicate
+     * for a new vertex.
+     *
+     * Nb: in O(n)
+     *
+     * @param aPoint  a new vertex of the preimage,
+     * @param aContainer  the container to be updated (myPHull or myQHull).
+     *
+     * @tparam Predicate  the type of Predicate
+     */
+    template <typename Predicate>
+    void updateBack(const Point & aPoint,
+                    Container & aContainer);
 
     // ------------------------- Internals ------------------------------------
   private:
@@ -432,9 +450,9 @@ namespace DGtal
    * @param object the object of class 'Preimage2D' to write.
    * @return the output stream after the writing.
    */
-   template <typename Shape>
+  template <typename Shape, typename TContainer>
   std::ostream&
-  operator<< ( std::ostream & out, const Preimage2D<Shape> & object );
+  operator<< ( std::ostream & out, const Preimage2D<Shape, TContainer> & object );
 
 
 } // namespace DGtal
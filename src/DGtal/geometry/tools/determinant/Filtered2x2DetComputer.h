@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cstddef>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/geometry/tools/determinant/C2x2DetComputer.h"
@@ -72,8 +73,14 @@ namespace DGtal
    *
    * If the result of \f$ ay - bx \f$ is not null,
    * the IEC-559 / IEEE-754 standard guarantees that 
-   * the result is not zero (filtering step). Otherwise, 
-   * we use another method to conclude. 
+   * the result is not zero (filtering step). If it is null
+   * and if both products are exactly represented, the result
+   * is zero. Otherwise, we use another method to conclude. 
+   *
+   * Many determinants sharing the same first column vector may be
+   * computed at once: the filtering step is done for all of them in
+   * a loop without branches, that the compiler can vectorize, and
+   * the other method is only used for the null results. 
    *
    * This class is a model of C2x2DetComputer. 
    *
@@ -137,6 +144,19 @@ namespace DGtal
      */
     ResultInteger operator()(const ArgumentInteger& aX, const ArgumentInteger& aY) const;
 
+    /**
+     * Batch incremental operator.
+     * @pre init must be called before
+     * @param aX array of the 0-components of the second column vectors
+     * @param aY array of the 1-components of the second column vectors
+     * @param aSize number of second column vectors
+     * @param aResults array of @a aSize values, where the sign of 
+     * the 2x2 matrix determinants, ie. -1, 0 or 1, are written
+     * (the i-th value is the same as operator()( @a aX [i], @a aY [i] )). 
+     */
+    void operator()(const ArgumentInteger* aX, const ArgumentInteger* aY, 
+		    std::size_t aSize, ResultInteger* aResults) const;
+
     /**
      * Operator.
      * @param aA 0-component of the first column vector
@@ -188,6 +208,14 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * @return the bound under which (in absolute value) 
+     * the integers of type ArgumentInteger are exactly represented, 
+     * so that the products whose rounded result is strictly under this
+     * bound are exact. 
+     */
+    static ArgumentInteger exactBound(); 
+
   }; // end of class Filtered2x2DetComputer
 
 
@@ -42,9 +42,11 @@
 // Inclusions
 #include <array>
 #include <iostream>
+#include <cstddef>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/geometry/tools/determinant/C2x2DetComputer.h"
+#include "DGtal/geometry/tools/determinant/Filtered2x2DetComputer.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -163,6 +165,25 @@ namespace DGtal
      */
     Value operator()(const Point& aR) const;
 
+    /**
+     * Batch operator, which computes the orientation of @a aP, @a aQ
+     * and each point of the range [ @a itb , @a ite ). 
+     * The points are processed by blocks: if the determinant computer 
+     * is a Filtered2x2DetComputer, the determinants of a whole block
+     * are computed at once, otherwise one by one. 
+     * @warning InHalfPlaneBy2x2DetComputer::init() should be called before
+     * @param itb begin iterator on the points to test
+     * @param ite end iterator on the points to test
+     * @param res output iterator used to export the orientations
+     * @return output iterator after the last written orientation
+     * @tparam ForwardIterator a model of forward and readable iterator on points
+     * @tparam OutputIterator a model of incrementable and writable iterator on values
+     * @see InHalfPlaneBy2x2DetComputer::operator()(const Point&)
+     */
+    template <typename ForwardIterator, typename OutputIterator>
+    OutputIterator operator()(const ForwardIterator& itb, const ForwardIterator& ite, 
+			      OutputIterator res) const;
+
     /**
      * Writes/Displays the object on an output stream.
      * @param out the output stream where the object is written.
@@ -192,6 +213,34 @@ namespace DGtal
      */
     mutable DetComputer myDetComputer; 
 
+    /**
+     * Computes the determinants of a block of second column vectors
+     * one by one. 
+     * @param aDetComputer any initialized determinant computer
+     * @param aX array of the 0-components of the second column vectors
+     * @param aY array of the 1-components of the second column vectors
+     * @param aSize number of second column vectors
+     * @param aResults array of @a aSize determinants
+     */
+    template <typename TDetComputer2>
+    static void computeDets(TDetComputer2& aDetComputer, 
+			    const ArgumentInteger* aX, const ArgumentInteger* aY, 
+			    std::size_t aSize, Value* aResults); 
+
+    /**
+     * Computes the determinants of a block of second column vectors
+     * at once. 
+     * @param aDetComputer any initialized filtered determinant computer
+     * @param aX array of the 0-components of the second column vectors
+     * @param aY array of the 1-components of the second column vectors
+     * @param aSize number of second column vectors
+     * @param aResults array of @a aSize determinants
+     */
+    template <typename TDetComputer2>
+    static void computeDets(Filtered2x2DetComputer<TDetComputer2>& aDetComputer, 
+			    const ArgumentInteger* aX, const ArgumentInteger* aY, 
+			    std::size_t aSize, Value* aResults); 
+
   }; // end of class InHalfPlaneBy2x2DetComputer
 
 
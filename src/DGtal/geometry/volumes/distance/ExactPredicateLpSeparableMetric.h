@@ -46,6 +46,7 @@
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CSpace.h"
+#include "DGtal/kernel/PointBatch.h"
 #include "DGtal/kernel/CInteger.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -109,6 +110,9 @@ namespace DGtal
     ///Self type
     typedef ExactPredicateLpSeparableMetric<TSpace,p,RawValue> Self;
 
+    ///Type for batches of points (structure of arrays)
+    typedef PointBatch<Point::dimension, Abscissa> Batch;
+
     /**
      * Constructor.
      */
@@ -179,6 +183,27 @@ namespace DGtal
      */
     RawValue rawDistance(const Point & aP, const Point &aQ) const;
 
+    /**
+     * Computes the raw distances between @a aP and all the points of
+     * @a aBatch, as rawDistance, in a single loop over the contiguous
+     * coordinates of the batch.
+     *
+     * @param aP a point.
+     * @param aBatch a batch of points.
+     * @param[out] values an array of at least aBatch.size() values.
+     */
+    void rawDistances(const Point &aP, const Batch &aBatch, RawValue* values) const;
+
+    /**
+     * Computes the distances between @a aP and all the points of
+     * @a aBatch, as operator().
+     *
+     * @param aP a point.
+     * @param aBatch a batch of points.
+     * @param[out] values an array of at least aBatch.size() values.
+     */
+    void distances(const Point &aP, const Batch &aBatch, Value* values) const;
+
       // ----------------------- CSeparableMetric --------------------------------------
     /**
      * Given three sites (u,v,w) and a straight segment
@@ -281,6 +306,9 @@ namespace DGtal
     ///Self type
     typedef ExactPredicateLpSeparableMetric<TSpace,2,TRawValue> Self;
 
+    ///Type for batches of points (structure of arrays)
+    typedef PointBatch<Point::dimension, Abscissa> Batch;
+
     /**
      * Constructor.
      */
@@ -369,6 +397,27 @@ namespace DGtal
      */
     RawValue rawDistance(const Point &aP, const Point &aQ) const;
 
+    /**
+     * Computes the raw distances between @a aP and all the points of
+     * @a aBatch, as rawDistance, in a single loop over the contiguous
+     * coordinates of the batch.
+     *
+     * @param aP a point.
+     * @param aBatch a batch of points.
+     * @param[out] values an array of at least aBatch.size() values.
+     */
+    void rawDistances(const Point &aP, const Batch &aBatch, RawValue* values) const;
+
+    /**
+     * Computes the distances between @a aP and all the points of
+     * @a aBatch, as operator().
+     *
+     * @param aP a point.
+     * @param aBatch a batch of points.
+     * @param[out] values an array of at least aBatch.size() values.
+     */
+    void distances(const Point &aP, const Batch &aBatch, Value* values) const;
+
     // ----------------------- CSeparableMetric --------------------------------------
     /**
      * Given three sites (a,b,c) and a straight segment
@@ -42,6 +42,9 @@
 // Inclusions
 #include <cmath>
 #include <iostream>
+#include <vector>
+#include <mutex>
+#include <map>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/BasicMathFunctions.h"
 #include "DGtal/kernel/BasicPointPredicates.h"
@@ -65,7 +68,17 @@ namespace DGtal
    * arbitrary function with given support.
    *
    * You may obtain the whole sequence (Point,VCM) by accessing the
-   * map \ref vcmMap.
+   * map \ref vcmMap, or more efficiently through the dense arrays
+   * \ref sites and \ref vcms, the index of a site being given by
+   * \ref index.
+   *
+   * The covariance contributions of the voxels of the R-offset are
+   * accumulated scanline by scanline. If DGtal has been built with
+   * OpenMP support (WITH_OPENMP flag set to "true"), scanlines are
+   * processed in parallel, each thread accumulating into its own array
+   * of matrices (one per site), which are summed site by site at the
+   * end. The sums are reproducible for a given number of threads, but
+   * may differ in the last bits from the sequential ones.
    *
    * @note Documentation in \ref moduleVCM_sec2.
    *
@@ -121,6 +134,8 @@ namespace DGtal
     typedef typename MatrixNN::RowVector VectorN;             ///< the type for N-vector of real numbers
     typedef std::vector<Point> PointContainer;                ///< the list of points
     typedef std::map<Point,MatrixNN> Point2MatrixNN;          ///< Associates a matrix to points.
+    typedef std::size_t Index;                                ///< the type for indexing sites.
+    typedef DGtal::ImageContainerBySTLVector<Domain,Index> IndexImage; ///< the type of the dense table Point -> site index.
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -182,8 +197,27 @@ namespace DGtal
     /// @return the Voronoi Covariance Matrix of each Voronoi cell as
     /// a map Point -> Matrix
     /// @note empty if \ref init has not been called.
+    /// @note the map is built from \ref sites and \ref vcms on the
+    /// first call after \ref init, then kept. Prefer \ref sites and
+    /// \ref vcms, which need no extra storage. Concurrent calls are
+    /// safe: the map is built under a lock.
     const Point2MatrixNN& vcmMap() const;
 
+    /// @return the sites (i.e. the points of K without duplicates),
+    /// sorted in increasing order. The i-th site has index i.
+    /// @note empty if \ref init has not been called.
+    const PointContainer& sites() const;
+
+    /// @return the Voronoi Covariance Matrix of each Voronoi cell,
+    /// the i-th matrix being the one of the i-th site.
+    /// @note empty if \ref init has not been called.
+    const std::vector<MatrixNN>& vcms() const;
+
+    /// @param p any site.
+    /// @return the index of site \a p in \ref sites and \ref vcms.
+    /// @pre init must have been called before and clean not since.
+    Index index( const Point& p ) const;
+
     /**
     Computes the Voronoi Covariance Measure of the function \a chi_r.
     
@@ -235,8 +269,16 @@ namespace DGtal
     CharacteristicSet* myCharSet;
     /// Stores the voronoi map.
     Voronoi* myVoronoi;
-    /// The map point -> VCM
-    Point2MatrixNN myVCM;
+    /// The sites of K, sorted.
+    PointContainer mySites;
+    /// The VCM of each site, with the same indices as mySites.
+    std::vector<MatrixNN> myVCM;
+    /// The map site -> VCM, built lazily by vcmMap from mySites and myVCM.
+    mutable Point2MatrixNN myVCMMap;
+    /// Protects the lazy construction of myVCMMap.
+    mutable std::mutex myVCMMapMutex;
+    /// The dense table point -> index of site (only valid on sites).
+    IndexImage* myIndices;
     /// The structure used for proximity queries.
     ProximityStructure* myProximityStructure;
 
@@ -269,6 +311,16 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Accumulates the covariance contributions of the points of the
+       scanline starting at \a start along the first axis into \a acc.
+
+       @param start the first point of the scanline (on the lower
+       face of the domain).
+       @param[in,out] acc the matrices of all sites, indexed as mySites.
+    */
+    void accumulateScanline( const Point& start, std::vector<MatrixNN>& acc ) const;
+
   }; // end of class VoronoiCovarianceMeasure
 
 
@@ -112,7 +112,8 @@ namespace DGtal
    * which is returned by the outputIterator() method for writing purposes.
    *
    * Lastly, built-in iterators and a fast span iterator to perform 1D scans
-   * are also provided.
+   * are also provided, as well as the scanlines of the image, i.e. the
+   * contiguous values along the first axis (see scanline()).
    *
    * @tparam TDomain a HyperRectDomain.
    * @tparam TValue at least a model of CLabel.
@@ -285,6 +286,55 @@ namespace DGtal
     Range range();
 
 
+    /////////////////////////// Scanlines  /////////////////////
+
+    /**
+     * A scanline of the image, i.e. the values of a scanline of its
+     * domain, which are contiguous in the container.
+     * @see HyperRectDomain::scanline
+     */
+    struct Scanline
+    {
+      /// the first point of the scanline.
+      Point start;
+      /// the number of points of the scanline.
+      Size size;
+      /// random-access iterator on the values of the points of the scanline.
+      Iterator values;
+    };
+
+    /**
+     * A read-only scanline of the image.
+     */
+    struct ConstScanline
+    {
+      /// the first point of the scanline.
+      Point start;
+      /// the number of points of the scanline.
+      Size size;
+      /// random-access iterator on the values of the points of the scanline.
+      ConstIterator values;
+    };
+
+    /**
+     * @return the number of scanlines of the image domain.
+     */
+    Size nbScanlines() const;
+
+    /**
+     * @param i the index of a scanline, lower than nbScanlines().
+     * @return the scanline of index @a i, whose values can be
+     * read and written.
+     */
+    Scanline scanline( const Size i );
+
+    /**
+     * @param i the index of a scanline, lower than nbScanlines().
+     * @return the scanline of index @a i.
+     */
+    ConstScanline scanline( const Size i ) const;
+
+
     /////////////////////////// Custom Iterator ///////////////
     /**
      * Specific SpanIterator on ImageContainerBySTLVector.
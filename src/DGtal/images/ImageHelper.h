@@ -56,6 +56,7 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
@@ -147,6 +148,45 @@ namespace DGtal
 		    const typename I::Value& low,
 		    const typename I::Value& up); 
 
+  /**
+   * Overload of setFromImage for images stored in a vector: the
+   * values are read scanline by scanline (see
+   * ImageContainerBySTLVector::scanline) and the points are built
+   * along the first axis, instead of iterating over the domain.
+   *
+   * @param aImg any image stored in a vector
+   * @param ito set inserter
+   * @param aThreshold any value (default: 0)
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V any value type
+   * @tparam O any model of output iterator
+   */
+  template<typename D, typename V, typename O>
+  void setFromImage(const ImageContainerBySTLVector<D,V>& aImg, 
+		    const O& ito, 
+		    const typename ImageContainerBySTLVector<D,V>::Value& aThreshold = 0); 
+
+  /**
+   * Overload of setFromImage for images stored in a vector, with
+   * values between @a low and @a up (both included), read scanline
+   * by scanline.
+   *
+   * @param aImg any image stored in a vector
+   * @param ito set inserter
+   * @param low lower value
+   * @param up upper value
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V any value type
+   * @tparam O any model of output iterator
+   */
+  template<typename D, typename V, typename O>
+  void setFromImage(const ImageContainerBySTLVector<D,V>& aImg, 
+		    const O& ito, 
+		    const typename ImageContainerBySTLVector<D,V>::Value& low,
+		    const typename ImageContainerBySTLVector<D,V>::Value& up); 
+
 
   /**
    * Set the values of @a aImg at @a aValue
@@ -192,6 +232,22 @@ namespace DGtal
   template<typename I, typename F>
   void imageFromFunctor(I& aImg, const F& aFun); 
 
+  /**
+   * Overload of imageFromFunctor for images stored in a vector: the
+   * values are written scanline by scanline (see
+   * ImageContainerBySTLVector::scanline), the points being built
+   * along the first axis instead of iterating over the domain.
+   *
+   * @param aImg (returned) image
+   * @param aFun a unary functor
+   *
+   * @tparam D a HyperRectDomain
+   * @tparam V any value type
+   * @tparam F any model of CPointFunctor
+   */
+  template<typename D, typename V, typename F>
+  void imageFromFunctor(ImageContainerBySTLVector<D,V>& aImg, const F& aFun); 
+
   /**
    * Copy the values of @a aImg2 into @a aImg1 .
    *
@@ -398,8 +398,8 @@ template<Dimension dim, typename TComponent1, typename TComponent2, typename TCo
     
     
 // Preimage2D
-template <typename Shape>
-static void draw( DGtal::Board2D & aBoard, const DGtal::Preimage2D<Shape> & );
+template <typename Shape, typename TContainer>
+static void draw( DGtal::Board2D & aBoard, const DGtal::Preimage2D<Shape, TContainer> & );
 // Preimage2D
     
     
@@ -59,6 +59,13 @@ namespace DGtal
   const uint64_t NumberTraits<uint64_t>::ONE = 1;
   const uint64_t NumberTraits<uint64_t>::ZERO = 0;
 
+#ifdef WITH_INT128
+  const int128_t NumberTraits<int128_t>::ONE = 1;
+  const int128_t NumberTraits<int128_t>::ZERO = 0;
+  const uint128_t NumberTraits<uint128_t>::ONE = 1;
+  const uint128_t NumberTraits<uint128_t>::ZERO = 0;
+#endif
+
   const float NumberTraits<float>::ONE = 1.0f;
   const float NumberTraits<float>::ZERO = 0.0f;
 
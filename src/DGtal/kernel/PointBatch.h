@@ -0,0 +1,337 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PointBatch.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PointBatch.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PointBatch_RECURSES)
+#error Recursive header files inclusion detected in PointBatch.h
+#else // defined(PointBatch_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PointBatch_RECURSES
+
+#if !defined PointBatch_h
+/** Prevents repeated inclusion of headers. */
+#define PointBatch_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/PointVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointBatch
+  /**
+   * Description of template class 'PointBatch' <p>
+   * \brief Aim: A sequence of points stored as a structure of arrays,
+   * i.e. one array per coordinate, so that the same operation can be
+   * applied to many points with loops over contiguous arrays, that
+   * the compiler vectorizes.
+   *
+   * The arithmetic operations, norms, inner products and comparisons
+   * of PointVector are provided for the whole batch. The results are
+   * written in arrays of at least size() values (one per point), and
+   * the comparisons give masks, i.e. arrays of booleans.
+   *
+   * It is mostly meant for points of dimension 2 and 3, and is used by
+   * the batch services of ExactPredicateLpSeparableMetric,
+   * ImplicitBall and GaussDigitizer.
+   *
+   * @code
+   typedef PointBatch<3, DGtal::int32_t> Batch;
+   Batch batch( domain.begin(), domain.end() );
+   batch -= center;
+   std::vector<Batch::UnsignedComponent> norms( batch.size() );
+   batch.norm1( norms.data() );
+   * @endcode
+   *
+   * @tparam dim the dimension of the points.
+   * @tparam TComponent the type of the coordinates, a model of
+   * CEuclideanRing.
+   *
+   * @see PointVector testPointBatch.cpp
+   */
+  template <DGtal::Dimension dim, typename TComponent>
+  class PointBatch
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef PointBatch<dim, TComponent> Self;
+    typedef TComponent Component;
+    typedef typename NumberTraits<Component>::UnsignedVersion UnsignedComponent;
+    typedef PointVector<dim, Component> Point;
+    typedef Point Vector;
+    typedef std::size_t Size;
+    /// The coordinates of all the points along one axis.
+    typedef std::vector<Component> Coordinates;
+
+    /// Copy of the dimension.
+    static const DGtal::Dimension dimension = dim;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The batch is empty.
+     */
+    PointBatch();
+
+    /**
+     * Constructor.
+     * @param n the number of points, initialized to zero.
+     */
+    explicit PointBatch( const Size n );
+
+    /**
+     * Constructor from a range of points.
+     * @tparam TInputIterator a model of input iterator on points.
+     * @param itb begin iterator on the points.
+     * @param ite end iterator on the points.
+     */
+    template <typename TInputIterator>
+    PointBatch( TInputIterator itb, TInputIterator ite );
+
+    /**
+     * Destructor.
+     */
+    ~PointBatch();
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /**
+     * @return the number of points.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' if the batch has no point.
+     */
+    bool empty() const;
+
+    /**
+     * Removes all the points.
+     */
+    void clear();
+
+    /**
+     * Reserves the memory for @a n points.
+     * @param n a number of points.
+     */
+    void reserve( const Size n );
+
+    /**
+     * Changes the number of points, the new ones being zero.
+     * @param n the new number of points.
+     */
+    void resize( const Size n );
+
+    /**
+     * Adds a point at the end.
+     * @param p any point.
+     */
+    void push_back( const Point & p );
+
+    /**
+     * @param i the index of a point.
+     * @return the point of index @a i.
+     */
+    Point operator[]( const Size i ) const;
+
+    /**
+     * Replaces a point.
+     * @param i the index of a point.
+     * @param p the new point of index @a i.
+     */
+    void set( const Size i, const Point & p );
+
+    /**
+     * @param k an axis.
+     * @return the coordinates of all the points along axis @a k.
+     */
+    const Coordinates & coordinates( const DGtal::Dimension k ) const;
+
+    /**
+     * @param k an axis.
+     * @return a reference on the coordinates of all the points along
+     * axis @a k (the number of points must not be changed).
+     */
+    Coordinates & coordinates( const DGtal::Dimension k );
+
+    // ----------------------- Arithmetic services ----------------------------
+  public:
+
+    /**
+     * Translates all the points.
+     * @param v any vector.
+     * @return a reference on 'this'.
+     */
+    Self & operator+=( const Vector & v );
+
+    /**
+     * Translates all the points.
+     * @param v any vector.
+     * @return a reference on 'this'.
+     */
+    Self & operator-=( const Vector & v );
+
+    /**
+     * Adds the points of another batch, point by point.
+     * @param other a batch with the same number of points.
+     * @return a reference on 'this'.
+     */
+    Self & operator+=( const Self & other );
+
+    /**
+     * Subtracts the points of another batch, point by point.
+     * @param other a batch with the same number of points.
+     * @return a reference on 'this'.
+     */
+    Self & operator-=( const Self & other );
+
+    /**
+     * Multiplies all the coordinates by a scalar.
+     * @param coeff any scalar.
+     * @return a reference on 'this'.
+     */
+    Self & operator*=( const Component coeff );
+
+    /**
+     * Computes the inner product of each point with a vector.
+     * @param v any vector.
+     * @param[out] values an array of at least size() values.
+     */
+    void dot( const Vector & v, Component* values ) const;
+
+    /**
+     * Computes the squared Euclidean norm of each point, i.e. its inner
+     * product with itself.
+     * @param[out] values an array of at least size() values.
+     */
+    void squaredNorm( Component* values ) const;
+
+    /**
+     * Computes the Euclidean norm of each point, as PointVector::norm.
+     * @param[out] values an array of at least size() values.
+     */
+    void norm( double* values ) const;
+
+    /**
+     * Computes the 1-norm of each point, as PointVector::norm1.
+     * @param[out] values an array of at least size() values.
+     */
+    void norm1( UnsignedComponent* values ) const;
+
+    /**
+     * Computes the infinity-norm of each point, as
+     * PointVector::normInfinity.
+     * @param[out] values an array of at least size() values.
+     */
+    void normInfinity( UnsignedComponent* values ) const;
+
+    // ----------------------- Comparison services ----------------------------
+  public:
+
+    /**
+     * Compares each point with @a p, as PointVector::isLower.
+     * @param p any point.
+     * @param[out] mask an array of at least size() booleans, 'true'
+     * when the point is below @a p.
+     */
+    void isLower( const Point & p, bool* mask ) const;
+
+    /**
+     * Compares each point with @a p, as PointVector::isUpper.
+     * @param p any point.
+     * @param[out] mask an array of at least size() booleans, 'true'
+     * when the point is above @a p.
+     */
+    void isUpper( const Point & p, bool* mask ) const;
+
+    /**
+     * Tests if each point lies in a box, as HyperRectDomain::isInside.
+     * @param lower the lowest point of the box.
+     * @param upper the uppermost point of the box.
+     * @param[out] mask an array of at least size() booleans, 'true'
+     * when the point is in the box.
+     */
+    void isInside( const Point & lower, const Point & upper, bool* mask ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// the coordinates of the points, one array per axis.
+    Coordinates myCoordinates[ dim ];
+
+  }; // end of class PointBatch
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PointBatch'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PointBatch' to write.
+   * @return the output stream after the writing.
+   */
+  template <DGtal::Dimension dim, typename TComponent>
+  std::ostream&
+  operator<< ( std::ostream & out, const PointBatch<dim, TComponent> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/PointBatch.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PointBatch_h
+
+#undef PointBatch_RECURSES
+#endif // else defined(PointBatch_RECURSES)
@@ -592,6 +592,57 @@ namespace DGtal
      */
     const Predicate & predicate() const;
 
+    // ----------------------- Scanline services ------------------------------
+  public:
+
+    /**
+     * A scanline of the domain, i.e. a run of consecutive points
+     * along the first axis, from the lower bound to the upper bound
+     * of the domain along this axis.
+     */
+    struct Scanline
+    {
+      /// the first point of the scanline.
+      Point start;
+      /// the number of points of the scanline.
+      Size size;
+    };
+
+    /**
+     * @return the number of scanlines of the domain, i.e. its number
+     * of points divided by scanlineSize(), or 0 if it is empty.
+     */
+    Size nbScanlines() const;
+
+    /**
+     * @return the number of points of each scanline, i.e. the extent
+     * of the domain along the first axis, or 0 if it is empty.
+     */
+    Size scanlineSize() const;
+
+    /**
+     * Scanlines are numbered in the order of the points of the domain,
+     * so that the points of the scanline of index @a i are the points
+     * of linear indices @a i * scanlineSize() to (@a i + 1) *
+     * scanlineSize() - 1. Iterating over them with a loop along the
+     * first axis is faster than iterating over the domain, whose
+     * iterator checks all the coordinates at each step.
+     *
+     * @code
+     for ( Size i = 0; i < domain.nbScanlines(); ++i )
+       {
+         typename Domain::Scanline s = domain.scanline( i );
+         Point p = s.start;
+         for ( Size j = 0; j < s.size; ++j, ++p[ 0 ] )
+           ... // p is a point of the domain
+       }
+     * @endcode
+     *
+     * @param i the index of a scanline, lower than nbScanlines().
+     * @return the scanline of index @a i.
+     */
+    Scanline scanline( const Size i ) const;
+
     // ------------------------- Private Datas --------------------------------
   private:
 
@@ -0,0 +1,237 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MPolynomialScanlineEvaluator.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MPolynomialScanlineEvaluator.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MPolynomialScanlineEvaluator_RECURSES)
+#error Recursive header files inclusion detected in MPolynomialScanlineEvaluator.h
+#else // defined(MPolynomialScanlineEvaluator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MPolynomialScanlineEvaluator_RECURSES
+
+#if !defined MPolynomialScanlineEvaluator_h
+/** Prevents repeated inclusion of headers. */
+#define MPolynomialScanlineEvaluator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/MPolynomial.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MPolynomialScanlineEvaluator
+  /**
+     Description of template class 'MPolynomialScanlineEvaluator' <p>
+     \brief Aim: A flat, compiled form of a 3-variate polynomial
+     MPolynomial<3,TRing>, designed to evaluate it quickly on many
+     points of a scanline, i.e. points \f$ (x_0 + i \cdot dx, y, z)
+     \f$ for \f$ i = 0, \ldots, n-1 \f$.
+
+     The recursive coefficient vectors of the MPolynomial are copied
+     once into a dense array \f$ c_{ijk} \f$ (coefficient of \f$ x^i
+     y^j z^k \f$). Evaluating a scanline first reduces the
+     coefficients in \a z then \a y with a Horner scheme, which gives
+     the univariate polynomial \f$ \sum_i a_i x^i \f$ of the
+     scanline. The latter is then evaluated on all points with a
+     Horner scheme whose inner loop runs over the points and has no
+     dependency between iterations, so that it is vectorized by the
+     compiler.
+
+     This evaluation is much faster than calling
+     MPolynomial::operator() on each point, which goes through the
+     recursive MPolynomialEvaluatorImpl machinery.
+
+     @code
+     MPolynomial<3, double> P = mmonomial<double>( 2, 0, 0 ) + ...;
+     MPolynomialScanlineEvaluator<double> eval( P );
+     std::vector<double> values( 100 );
+     eval.evaluateScanline( y, z, x0, 0.1, values.size(), values.data() );
+     @endcode
+
+     @tparam TRing the type for the coefficients and the values
+     (generally float or double).
+  */
+  template <typename TRing>
+  class MPolynomialScanlineEvaluator
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TRing Ring;
+    typedef MPolynomial< 3, Ring > Polynomial3;
+
+    /**
+     * Constructor. The object represents the zero polynomial.
+     */
+    MPolynomialScanlineEvaluator();
+
+    /**
+     * Constructor from a polynomial.
+     * @param poly any 3-variate polynomial.
+     */
+    MPolynomialScanlineEvaluator( const Polynomial3 & poly );
+
+    /**
+     * Compiles the given polynomial, forgetting the previous one.
+     * @param poly any 3-variate polynomial.
+     */
+    void init( const Polynomial3 & poly );
+
+    // ----------------------- Evaluation services ----------------------------
+  public:
+
+    /**
+       @param x the first coordinate.
+       @param y the second coordinate.
+       @param z the third coordinate.
+       @return the value of the polynomial at (x,y,z).
+    */
+    Ring operator()( const Ring x, const Ring y, const Ring z ) const;
+
+    /**
+       Evaluates the polynomial at the \a n points \f$ (x_0 + i
+       \cdot dx, y, z) \f$, \f$ i = 0, \ldots, n-1 \f$.
+
+       @param y the second coordinate of the scanline.
+       @param z the third coordinate of the scanline.
+       @param x0 the first coordinate of the first point.
+       @param dx the increment along the first coordinate.
+       @param n the number of points.
+       @param[out] values an array of at least \a n values, where the
+       i-th value of the scanline is written.
+    */
+    void evaluateScanline( const Ring y, const Ring z,
+                           const Ring x0, const Ring dx,
+                           std::size_t n, Ring* values ) const;
+
+    /**
+       Same as above, but uses \a work as temporary storage for the
+       coefficients of the scanline and its abscissas, so that
+       evaluating many scanlines with the same buffer allocates
+       nothing once the buffer is large enough.
+
+       @param y the second coordinate of the scanline.
+       @param z the third coordinate of the scanline.
+       @param x0 the first coordinate of the first point.
+       @param dx the increment along the first coordinate.
+       @param n the number of points.
+       @param[out] values an array of at least \a n values, where the
+       i-th value of the scanline is written.
+       @param[in,out] work a buffer, enlarged if needed.
+    */
+    void evaluateScanline( const Ring y, const Ring z,
+                           const Ring x0, const Ring dx,
+                           std::size_t n, Ring* values,
+                           std::vector<Ring> & work ) const;
+
+    /**
+       Computes the coefficients \f$ a_i \f$ of the univariate
+       polynomial \f$ x \mapsto P(x,y,z) \f$.
+
+       @param y the second coordinate of the scanline.
+       @param z the third coordinate of the scanline.
+       @param[out] coefs an array of at least degreeX()+1 values.
+    */
+    void scanlineCoefficients( const Ring y, const Ring z,
+                               Ring* coefs ) const;
+
+    /**
+       @return the degree in x of the compiled polynomial, or -1 if
+       it is the zero polynomial.
+    */
+    int degreeX() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+       @param i any index between 0 and degreeX().
+       @param y the second coordinate.
+       @param z the third coordinate.
+       @return the coefficient of \f$ x^i \f$ of \f$ P(x,y,z) \f$.
+    */
+    Ring coefficientX( const int i, const Ring y, const Ring z ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Degree in x, -1 for the zero polynomial.
+    int myDegX;
+    /// Maximal degree in y among all coefficients, plus one.
+    int mySizeY;
+    /// Maximal degree in z among all coefficients, plus one.
+    int mySizeZ;
+    /// Dense coefficients c_ijk stored at ( i * mySizeY + j ) * mySizeZ + k.
+    std::vector<Ring> myCoefs;
+
+  }; // end of class MPolynomialScanlineEvaluator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MPolynomialScanlineEvaluator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MPolynomialScanlineEvaluator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TRing>
+  std::ostream&
+  operator<< ( std::ostream & out, const MPolynomialScanlineEvaluator<TRing> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/MPolynomialScanlineEvaluator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MPolynomialScanlineEvaluator_h
+
+#undef MPolynomialScanlineEvaluator_RECURSES
+#endif // else defined(MPolynomialScanlineEvaluator_RECURSES)
@@ -44,11 +44,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/kernel/RegularPointEmbedder.h"
+#include "DGtal/kernel/PointBatch.h"
 #include "DGtal/shapes/CEuclideanOrientedShape.h"
 #include "DGtal/shapes/CEuclideanBoundedShape.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -87,6 +90,8 @@ namespace DGtal
     typedef TEuclideanShape EuclideanShape;
     typedef HyperRectDomain<Space> Domain;
     typedef RegularPointEmbedder<Space> PointEmbedder;
+    typedef PointBatch<Space::dimension, Integer> Batch;
+    typedef PointBatch<Space::dimension, typename RealPoint::Component> RealBatch;
 
     BOOST_CONCEPT_ASSERT(( concepts::CEuclideanOrientedShape<TEuclideanShape> ));
    
@@ -202,6 +207,41 @@ namespace DGtal
      */
     bool operator()( const Point & p ) const;
 
+    /**
+       Embeds all the points of a batch, as embed().
+
+       @param aBatch a batch of digital points.
+       @param[out] aRealBatch the batch of their embeddings in the
+       Euclidean space.
+    */
+    void embed( const Batch & aBatch, RealBatch & aRealBatch ) const;
+
+    /**
+       Computes the orientation of all the points of a batch, as
+       orientation(), by embedding the batch and giving it to the
+       shape at once.
+
+       @param aBatch a batch of digital points.
+       @param[out] orientations an array of at least aBatch.size() values.
+
+       @note The shape must provide a method \c orientations( const
+       RealBatch & aRealBatch, Orientation* orientations ), like
+       ImplicitBall.
+    */
+    void orientations( const Batch & aBatch, Orientation* orientations ) const;
+
+    /**
+       Tests all the points of a batch, as operator()( const Point & ).
+
+       @param aBatch a batch of digital points.
+       @param[out] mask an array of at least aBatch.size() booleans,
+       'true' when the point is inside or on the shape.
+
+       @note The shape must provide a method \c orientations, see
+       orientations( const Batch &, Orientation* ) const.
+    */
+    void operator()( const Batch & aBatch, bool* mask ) const;
+
     /**
        @return the lowest admissible digital point.
        @see init
@@ -224,6 +264,32 @@ namespace DGtal
     */
     RealVector gridSteps() const;
 
+    /**
+       Inserts into \a aSet all the points of the domain that are
+       inside or on the shape, processing the domain scanline by
+       scanline along the first axis. Scanlines are processed in
+       parallel if DGtal has been built with OpenMP support
+       (WITH_OPENMP flag set to "true").
+
+       This is much faster than testing each point with operator() for
+       shapes that can evaluate their implicit function on a whole
+       scanline at once, like ImplicitPolynomial3Shape.
+
+       @tparam TDigitalSet a model of concepts::CDigitalSet.
+
+       @param[in,out] aSet the set where points are inserted.
+
+       @note The shape must provide a method \c evaluateScanline(
+       const RealPoint & start, step, std::size_t n, values, work )
+       which writes in \a values the value of the implicit function at
+       the \a n points \c start + i * step * e_0, the shape interior
+       being the set of points with negative values. \a work is a
+       std::vector of coordinates that each thread reuses as temporary
+       storage from one scanline to the next.
+    */
+    template <typename TDigitalSet>
+    void digitizeByScanlines( TDigitalSet & aSet ) const;
+
 
     // ----------------------- Interface --------------------------------------
   public:
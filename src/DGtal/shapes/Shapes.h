@@ -94,16 +94,76 @@ namespace DGtal
      * an instance of ShapeFunctor. Add Points where orientation is inside.
      * The shape functor must be a model of CDigitalOrientedShape and
      * CDigitalBoundedShape.
+     *
+     * The set is filled scanline by scanline. When @a inParallel is
+     * true and OpenMP is enabled, the scanlines of the bounding box of
+     * the shape are processed in parallel, so the method orientation
+     * of the functor must be safe to call from several threads. The
+     * points are then inserted sequentially in the set.
+     *
+     * If @a aCoarseStep is greater than 1, each scanline is first
+     * sampled every @a aCoarseStep points, and the points between two
+     * samples are only evaluated if the two samples do not have the
+     * same inside/outside status (otherwise they are given this
+     * status). This is exact as long as the boundary of the shape does
+     * not cross a scanline twice between two samples, i.e. for shapes
+     * without parts thinner than @a aCoarseStep along the first axis.
      * 
      * @param aSet the set (modified) which will contain the shape.
      * @param aFunctor a functor defining the shape.
+     * @param aCoarseStep the sampling step along the scanlines (1
+     * means that every point is evaluated).
+     * @param inParallel when 'true', the scanlines are processed in
+     * parallel if OpenMP is enabled.
      * @tparam TDigitalSet a model of CDigitalSet.
      * @tparam TShapeFunctor a model of CDigitalBoundedShape and
      * CDigitalOrientedShape.
      */
     template <typename TDigitalSet, typename TShapeFunctor>
     static void digitalShaper( TDigitalSet & aSet,
-                               const TShapeFunctor & aFunctor);
+                               const TShapeFunctor & aFunctor,
+                               const Integer aCoarseStep = 1,
+                               const bool inParallel = false );
+
+    /**
+     * Fills the image [anImage] with a shape defined by an instance of
+     * ShapeFunctor: the points of the image domain where the
+     * orientation is inside or on are given the value @a anInsideValue
+     * and the other ones the value @a anOutsideValue. The points
+     * outside the bounding box of the shape are not evaluated.
+     *
+     * The image is filled scanline by scanline, the scanlines being
+     * shared in contiguous slabs between the threads when OpenMP is
+     * enabled (except for images of bool, whose values are packed).
+     * @a aCoarseStep is used as in digitalShaper.
+     *
+     * For a Euclidean shape, attach it to a GaussDigitizer and use
+     * an image whose domain is the one of the digitizer:
+     * @code
+     GaussDigitizer<Space, Shape> dig;
+     dig.attach( shape );
+     dig.init( shape.getLowerBound(), shape.getUpperBound(), h );
+     ImageContainerBySTLVector<Domain, unsigned char> image( dig.getDomain() );
+     Shapes<Domain>::digitalImageShaper( image, dig, 1, 0 );
+     * @endcode
+     *
+     * @param anImage the image (modified) which will contain the shape.
+     * @param aFunctor a functor defining the shape.
+     * @param anInsideValue the value of the points in the shape.
+     * @param anOutsideValue the value of the other points.
+     * @param aCoarseStep the sampling step along the scanlines (1
+     * means that every point is evaluated).
+     * @tparam TImage an image providing scanlines, such as
+     * ImageContainerBySTLVector.
+     * @tparam TShapeFunctor a model of CDigitalBoundedShape and
+     * CDigitalOrientedShape.
+     */
+    template <typename TImage, typename TShapeFunctor>
+    static void digitalImageShaper( TImage & anImage,
+                                    const TShapeFunctor & aFunctor,
+                                    const typename TImage::Value & anInsideValue,
+                                    const typename TImage::Value & anOutsideValue,
+                                    const Integer aCoarseStep = 1 );
 
     /** 
      * Adds to the (perhaps non empty) set [aSet] an shape defined by
@@ -115,6 +175,10 @@ namespace DGtal
      * @param aSet the set (modified) which will contain the shape.
      * @param aFunctor a functor defining the shape.
      * @param h grid step for the Gauss digitization.
+     * @param aCoarseStep the sampling step along the scanlines, see
+     * digitalShaper.
+     * @param inParallel when 'true', the scanlines are processed in
+     * parallel if OpenMP is enabled, see digitalShaper.
      *
      * @tparam TDigitalSet a model of CDigitalSet.
      * @tparam TShapeFunctor a model of CEuclideanBoundedShape and
@@ -123,7 +187,9 @@ namespace DGtal
     template <typename TDigitalSet, typename TShapeFunctor>
     static void euclideanShaper( TDigitalSet & aSet,
                                  const TShapeFunctor & aFunctor,
-                                 const double h = 1.0);
+                                 const double h = 1.0,
+                                 const Integer aCoarseStep = 1,
+                                 const bool inParallel = false );
 
     /**
        Add to the set \a aSet the points of the domain that satisfies
@@ -260,6 +326,27 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Writes the inside/outside status of the points of a scanline,
+     * sampled every @a aCoarseStep points (see digitalShaper).
+     *
+     * @param aFunctor a functor defining the shape.
+     * @param aStart the first point of the scanline.
+     * @param aSize the number of points of the scanline.
+     * @param aCoarseStep the sampling step along the scanline.
+     * @param itValues an output iterator on @a aSize values.
+     * @param anInsideValue the value written for the points in the shape.
+     * @param anOutsideValue the value written for the other points.
+     */
+    template <typename TShapeFunctor, typename TOutputIterator, typename TValue>
+    static void shapeScanline( const TShapeFunctor & aFunctor,
+                               const Point & aStart,
+                               const Integer aSize,
+                               const Integer aCoarseStep,
+                               TOutputIterator itValues,
+                               const TValue & anInsideValue,
+                               const TValue & anOutsideValue );
+
   }; // end of class Shapes
 
 
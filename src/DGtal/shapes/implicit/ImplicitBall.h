@@ -43,6 +43,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/PointBatch.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -70,6 +71,7 @@ namespace DGtal
     typedef typename Space::RealPoint RealPoint;
     typedef typename Space::Integer Integer;
     typedef double Value;
+    typedef PointBatch<Space::dimension, typename RealPoint::Component> RealBatch;
 
     /** 
      * Constructor. Contructs a ball with center aCenter and radius
@@ -110,6 +112,25 @@ namespace DGtal
           return ON;
     }
 
+    /**
+     * Evaluates the implicit function at all the points of a batch,
+     * as operator(), in a single loop over the contiguous coordinates
+     * of the batch.
+     *
+     * @param aBatch a batch of points.
+     * @param[out] values an array of at least aBatch.size() values.
+     */
+    void evaluate(const RealBatch &aBatch, Value* values) const;
+
+    /**
+     * Computes the orientation of all the points of a batch, as
+     * orientation(). Used by GaussDigitizer::orientations.
+     *
+     * @param aBatch a batch of points.
+     * @param[out] orientations an array of at least aBatch.size() values.
+     */
+    void orientations(const RealBatch &aBatch, Orientation* orientations) const;
+
     inline
     RealPoint getLowerBound() const
     {
@@ -46,6 +46,7 @@
 #include "DGtal/base/CPredicate.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/MPolynomialScanlineEvaluator.h"
 #include "DGtal/shapes/implicit/CImplicitFunction.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -75,6 +76,7 @@ namespace DGtal
     typedef typename RealPoint::Coordinate Ring;
     typedef typename Space::Integer Integer;
     typedef MPolynomial< 3, Ring > Polynomial3;
+    typedef MPolynomialScanlineEvaluator< Ring > ScanlineEvaluator;
     typedef Ring Value;
 
     BOOST_STATIC_ASSERT(( Space::dimension == 3 ));
@@ -130,6 +132,36 @@ namespace DGtal
     */
     Orientation orientation(const RealPoint &aPoint) const;
 
+    /**
+       Evaluates the polynomial at the \a n points \f$ aStart + i
+       \cdot aStep \cdot e_0 \f$, \f$ i = 0, \ldots, n-1 \f$, i.e. along
+       a scanline parallel to the first axis. This is much faster than
+       calling operator() on each point, and is used by
+       GaussDigitizer::digitizeByScanlines.
+
+       @param aStart the first point of the scanline.
+       @param aStep the increment along the first axis.
+       @param n the number of points.
+       @param[out] values an array of at least \a n values.
+    */
+    void evaluateScanline( const RealPoint & aStart, const Ring aStep,
+                           std::size_t n, Value* values ) const;
+
+    /**
+       Same as above, with a temporary buffer that may be reused from
+       one scanline to the next (see
+       MPolynomialScanlineEvaluator::evaluateScanline).
+
+       @param aStart the first point of the scanline.
+       @param aStep the increment along the first axis.
+       @param n the number of points.
+       @param[out] values an array of at least \a n values.
+       @param[in,out] work a buffer, enlarged if needed.
+    */
+    void evaluateScanline( const RealPoint & aStart, const Ring aStep,
+                           std::size_t n, Value* values,
+                           std::vector<Ring> & work ) const;
+
     /**
        @param aPoint any point in the Euclidean space.
        @return the gradient vector of the polynomial at \a aPoint.
@@ -222,6 +254,9 @@ namespace DGtal
     /// The 3-polynomial defining the implicit shape.
     Polynomial3 myPolynomial;
 
+    /// The polynomial compiled for fast evaluation along scanlines.
+    ScanlineEvaluator myScanlineEvaluator;
+
     // Partial deriatives
     Polynomial3 myFx;
     Polynomial3 myFy;
@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <sstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -261,12 +262,12 @@ bool testValidBezout( const IntegerComputer<Integer> & ic )
  * Example of a test. To be completed.
  *
  */
+template <typename Integer>
 bool testIntegerComputer()
 {
   unsigned int nbtests = 50;
   unsigned int nbok = 0;
   unsigned int nb = 0;
-  typedef BigInteger Integer;
   IntegerComputer<Integer> ic;
   trace.beginBlock ( "Testing block: multiple random gcd." );
   for ( unsigned int i = 0; i < nbtests; ++i )
@@ -325,13 +326,38 @@ bool testIntegerComputer()
   return nbok == nb;
 }
 
+#ifdef WITH_INT128
+/**
+ * Conversion of 128-bit integers to strings, down to the most negative
+ * value.
+ */
+bool testInt128ToString()
+{
+  const DGtal::uint128_t big = ( (DGtal::uint128_t) 1 ) << 100;
+  const DGtal::int128_t minimum = - (DGtal::int128_t) ( ( (DGtal::uint128_t) 1 ) << 126 ) * 2;
+  std::ostringstream out;
+  DGtal::operator<<( out, minimum );
+  trace.info() << "2^100=" << DGtal::to_string( big )
+               << " min=" << out.str() << std::endl;
+  return DGtal::to_string( big ) == "1267650600228229401496703205376"
+    && DGtal::to_string( (DGtal::int128_t) -42 ) == "-42"
+    && DGtal::to_string( (DGtal::uint128_t) 0 ) == "0"
+    && out.str() == "-170141183460469231731687303715884105728";
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int /*argc*/, char** /*argv*/ )
 {
   trace.beginBlock ( "Testing class IntegerComputer" );
-  bool res = testIntegerComputer(); // && ... other tests
+  bool res = testIntegerComputer<BigInteger>()
+#ifdef WITH_INT128
+    && testIntegerComputer<DGtal::int128_t>()
+    && testInt128ToString()
+#endif
+    ; // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
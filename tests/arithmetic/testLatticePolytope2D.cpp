@@ -29,6 +29,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <list>
+#include <vector>
+#include <algorithm>
 
 //#define DEBUG_LatticePolytope2D
 
@@ -329,6 +332,63 @@ bool specificTestLatticePolytope2D()
   return nbok == nb;
 }
 
+/**
+ * Checks that the same random cuts give the same vertices, whatever
+ * the sequence of vertices.
+ */
+template <typename Space>
+bool
+checkSequences()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef typename Space::Point Point;
+  typedef typename Space::Vector Vector;
+  typedef LatticePolytope2D<Space> CIP;
+  typedef LatticePolytope2D<Space, std::list<Point> > ListCIP;
+  typedef LatticePolytope2D<Space, std::vector<Point> > VectorCIP;
+  typedef typename CIP::HalfSpace HalfSpace;
+
+  trace.beginBlock ( "Check cuts with deque, list and vector of vertices" );
+  for ( unsigned int j = 0; j < 100; ++j )
+    {
+      CIP cip;
+      ListCIP cipL;
+      VectorCIP cipV;
+      Point V[ 4 ] = { Point( -100, -100 ), Point( -100, 100 ),
+                       Point( 100, 100 ), Point( 100, -100 ) };
+      for ( unsigned int k = 0; k < 4; ++k )
+        {
+          cip.pushBack( V[ k ] );
+          cipL.pushBack( V[ k ] );
+          cipV.pushBack( V[ k ] );
+        }
+      for ( unsigned int i = 0; ( i < 20 ) && ! cip.empty(); ++i )
+        {
+          int x = 0;
+          int y = 0;
+          while ( ( x == 0 ) && ( y == 0 ) )
+            {
+              x = myRand( 63 ) - 31;
+              y = myRand( 63 ) - 31;
+            }
+          HalfSpace h( Vector( x, y ), myRand( 2000 ) - 500 );
+          cip.cut( h );
+          cipL.cut( h );
+          cipV.cut( h );
+          ++nb, nbok += ( std::equal( cip.begin(), cip.end(), cipL.begin() )
+                          && std::equal( cip.begin(), cip.end(), cipV.begin() )
+                          && ( cip.size() == cipL.size() )
+                          && ( cip.size() == cipV.size() ) ) ? 1 : 0;
+        }
+      if ( nb != nbok ) break;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") same vertices" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 template <typename Space>
 bool
 checkOutputConvexHullBorder()
@@ -387,6 +447,7 @@ int main( int, char** )
   bool res = testLatticePolytope2D<Z2>()
     && testLatticePolytope2D<Z2I>()
     && exhaustiveTestLatticePolytope2D<Z2>()
+    && checkSequences<Z2>()
     && checkOutputConvexHullBorder<Z2>();
   //&& specificTestLatticePolytope2D<Z2>();
   //&& exhaustiveTestLatticePolytope2D<Z2I>();
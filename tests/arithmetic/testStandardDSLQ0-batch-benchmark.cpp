@@ -0,0 +1,172 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStandardDSLQ0-batch-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Compares the batch subsegment services of StandardDSLQ0 and
+ * DSLSubsegment with one query at a time.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+#include "DGtal/geometry/curves/DSLSubsegment.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking batch subsegment queries.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Fraction>
+void benchStandardDSLQ0( unsigned int nblines,
+                         typename Fraction::Integer modb,
+                         typename Fraction::Integer modx )
+{
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename Fraction::Integer Integer;
+  typedef typename DSL::SubsegmentQuery Query;
+  IntegerComputer<Integer> ic;
+
+  std::vector<DSL> lines;
+  typename DSL::SubsegmentQueries queries;
+  while ( lines.size() < nblines )
+    {
+      Integer b( rand() % modb + 1 );
+      Integer a( rand() % b + 1 );
+      if ( ic.gcd( a, b ) != 1 ) continue;
+      lines.push_back( DSL( a, b, rand() % ( 2 * modb ) ) );
+      for ( unsigned int k = 0; k < 50; ++k )
+        {
+          Query q;
+          q.line = rand() % lines.size();
+          Integer x1 = rand() % modx;
+          Integer x2 = x1 + 1 + ( rand() % modx );
+          q.A = lines[ q.line ].lowestY( x1 );
+          q.B = lines[ q.line ].lowestY( x2 );
+          queries.push_back( q );
+        }
+    }
+
+  Clock c;
+  std::vector<DSL> results( queries.size() );
+  // Creates the Stern-Brocot nodes used by the queries beforehand, so
+  // that both ways are timed on the same tree.
+  for ( std::size_t i = 0; i < queries.size(); ++i )
+    {
+      results[ i ] = lines[ queries[ i ].line ].smartDSS( queries[ i ].A, queries[ i ].B );
+      results[ i ] = lines[ queries[ i ].line ].reversedSmartDSS( queries[ i ].A, queries[ i ].B );
+    }
+  c.startClock();
+  for ( std::size_t i = 0; i < queries.size(); ++i )
+    results[ i ] = lines[ queries[ i ].line ].smartDSS( queries[ i ].A, queries[ i ].B );
+  double tOne = c.stopClock();
+  c.startClock();
+  DSL::batchSmartDSS( lines, queries, results );
+  double tBatch = c.stopClock();
+  c.startClock();
+  for ( std::size_t i = 0; i < queries.size(); ++i )
+    results[ i ] = lines[ queries[ i ].line ].reversedSmartDSS( queries[ i ].A, queries[ i ].B );
+  double tROne = c.stopClock();
+  c.startClock();
+  DSL::batchReversedSmartDSS( lines, queries, results );
+  double tRBatch = c.stopClock();
+  std::cout << modx << " " << queries.size()
+            << " " << tOne << " " << tBatch
+            << " " << tROne << " " << tRBatch << std::endl;
+}
+
+template <typename Integer>
+void benchDSLSubsegment( unsigned int nbqueries, Integer modb, Integer modx )
+{
+  typedef DSLSubsegment<Integer,Integer> DSLSubseg;
+  typedef typename DSLSubseg::Point Point;
+  typedef typename DSLSubseg::Query Query;
+  IntegerComputer<Integer> ic;
+
+  std::vector<Query> queries;
+  while ( queries.size() < nbqueries )
+    {
+      Query q;
+      q.b = rand() % modb + 1;
+      q.a = rand() % q.b + 1;
+      if ( ic.gcd( q.a, q.b ) != 1 ) continue;
+      q.mu = rand() % ( 2 * modb );
+      Integer x1 = rand() % modx;
+      Integer x2 = x1 + 1 + ( rand() % modx );
+      q.A = Point( x1, ic.floorDiv( q.a * x1 + q.mu, q.b ) );
+      q.B = Point( x2, ic.floorDiv( q.a * x2 + q.mu, q.b ) );
+      queries.push_back( q );
+    }
+
+  Clock c;
+  std::vector<typename DSLSubseg::Characteristics> results( queries.size() );
+  c.startClock();
+  for ( std::size_t i = 0; i < queries.size(); ++i )
+    {
+      Point A = queries[ i ].A;
+      Point B = queries[ i ].B;
+      DSLSubseg D( queries[ i ].a, queries[ i ].b, queries[ i ].mu, A, B, "farey" );
+      results[ i ].a = D.getA();
+      results[ i ].b = D.getB();
+      results[ i ].mu = D.getMu();
+    }
+  double tOne = c.stopClock();
+  c.startClock();
+  DSLSubseg::batch( queries, results, "farey" );
+  double tBatch = c.stopClock();
+  std::cout << modx << " " << queries.size()
+            << " " << tOne << " " << tBatch << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv)
+{
+  typedef SternBrocot<DGtal::int64_t,DGtal::int32_t> SB;
+  typedef SB::Fraction Fraction;
+  typedef Fraction::Integer Integer;
+  unsigned int nblines = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 2000;
+
+  Integer modb = 1000000000000;
+  std::cout << "# StandardDSLQ0: modx nbqueries smartDSS batchSmartDSS"
+            << " reversedSmartDSS batchReversedSmartDSS (ms)" << std::endl;
+  for ( Integer modx = 10; modx < modb / 2; modx *= 16 )
+    benchStandardDSLQ0<Fraction>( nblines, modb, modx );
+
+  std::cout << "# DSLSubsegment: modx nbqueries farey batch (ms)" << std::endl;
+  for ( Integer modx = 10; modx < 10000000; modx *= 16 )
+    benchDSLSubsegment<Integer>( 50 * nblines, 1000000, modx );
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/arithmetic/CPositiveIrreducibleFraction.h"
@@ -860,6 +861,55 @@ testSimplestFractionInBetween()
 }
 
 
+/**
+ * Fractions created concurrently (in a parallel loop if OpenMP is
+ * available) are the ones found afterwards in the tree.
+ */
+template <typename SB>
+bool testConcurrentFractions()
+{
+  typedef typename SB::Integer Integer;
+  typedef typename SB::Fraction Fraction;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: concurrent creation of fractions." );
+  const int n = 5000;
+  std::vector<Integer> ps( n ), qs( n );
+  for ( int i = 0; i < n; ++i )
+    {
+      ps[ i ] = 1 + rand() % 100000;
+      qs[ i ] = 1 + rand() % 100000;
+    }
+  std::vector<Fraction> fractions( n );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for ( int i = 0; i < n; ++i )
+    {
+      Fraction f = SB::fraction( ps[ i ], qs[ i ] );
+      // descendants and inverses are also created concurrently
+      f.left(); f.inverse().right();
+      fractions[ i ] = f;
+    }
+  const typename SB::Quotient nbFractions = SB::instance().nbFractions;
+  IntegerComputer<Integer> ic;
+  for ( int i = 0; i < n; ++i )
+    {
+      const Integer g = ic.gcd( ps[ i ], qs[ i ] );
+      const Fraction f = SB::fraction( ps[ i ], qs[ i ] );
+      nbok += ( f == fractions[ i ] && f.p() == ps[ i ] / g && f.q() == qs[ i ] / g
+                && f.left() == fractions[ i ].left()
+                && f.inverse().right().inverse() == f.left() ) ? 1 : 0;
+      ++nb;
+    }
+  // no fraction has been created twice
+  nbok += ( SB::instance().nbFractions == nbFractions ) ? 1 : 0;
+  ++nb;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "nbFractions = " << nbFractions << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -879,7 +929,8 @@ int main( int , char** )
     && testSubStandardDSLQ0<Fraction>()
     && testContinuedFractions<SB>()
     && testAncestors<SB>()
-    && testSimplestFractionInBetween<SB>();
+    && testSimplestFractionInBetween<SB>()
+    && testConcurrentFractions< SternBrocot<DGtal::int64_t,DGtal::int64_t> >();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,124 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStreamingDSSSegmentation-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the greedy DSS segmentation of a long stream of
+ * 4-connected points, made of pieces of digital straight lines of
+ * random slopes, in points per second:
+ * - GreedySegmentation with ArithmeticalDSSComputer,
+ * - StreamingDSSSegmentation, fed chunk by chunk.
+ *
+ * Usage: testStreamingDSSSegmentation-benchmark [nbPoints] [chunkSize]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/geometry/curves/ArithmeticalDSL.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/StreamingDSSSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef int Coordinate;
+typedef DGtal::int64_t Integer;
+typedef ArithmeticalDSL<Coordinate, Integer, 4> DSL;
+typedef DSL::Point Point;
+typedef std::vector<Point> Points;
+
+/**
+ * Pieces of standard DSLs of random slopes, each piece starting at the
+ * last point of the previous one.
+ */
+void makeStream( unsigned int nbPoints, Points & points )
+{
+  points.clear();
+  points.reserve( nbPoints );
+  points.push_back( Point( 0, 0 ) );
+  while ( points.size() < nbPoints )
+    {
+      const Coordinate a = ( rand() % 1000 ) * ( ( rand() % 2 ) ? 1 : -1 );
+      const Coordinate b = ( 1 + rand() % 1000 ) * ( ( rand() % 2 ) ? 1 : -1 );
+      const Point start = points.back();
+      const DSL dsl( a, b, DSL::remainder( a, b, start ) );
+      const unsigned int length = 100 + rand() % 5000;
+      DSL::ConstIterator it = dsl.begin( start );
+      ++it;
+      for ( unsigned int i = 0; ( i < length ) && ( points.size() < nbPoints ); ++i, ++it )
+        points.push_back( *it );
+    }
+}
+
+int main( int argc, char** argv )
+{
+  const unsigned int nbPoints = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 10000000;
+  const unsigned int chunkSize = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 4096;
+
+  Points points;
+  makeStream( nbPoints, points );
+  trace.info() << "points=" << points.size() << " chunk=" << chunkSize << endl;
+
+  Clock clock;
+  double time;
+
+  // greedy segmentation
+  typedef ArithmeticalDSSComputer<Points::const_iterator, Coordinate, 4> SegmentComputer;
+  typedef GreedySegmentation<SegmentComputer> Segmentation;
+  clock.startClock();
+  std::size_t nbSegments = 0;
+  Segmentation segmentation( points.begin(), points.end(), SegmentComputer() );
+  for ( Segmentation::SegmentComputerIterator it = segmentation.begin(),
+          itEnd = segmentation.end(); it != itEnd; ++it )
+    ++nbSegments;
+  time = clock.stopClock();
+  trace.info() << "GreedySegmentation: segments=" << nbSegments << " time=" << time << " ms"
+               << " points/s=" << 1000. * points.size() / time << endl;
+
+  // streaming segmentation
+  typedef StreamingDSSSegmentation<Coordinate, Integer, 4> Streaming;
+  clock.startClock();
+  Streaming streaming;
+  std::vector<Streaming::DSS> segments;
+  for ( std::size_t i = 0; i < points.size(); i += chunkSize )
+    {
+      const std::size_t j = std::min<std::size_t>( points.size(), i + chunkSize );
+      streaming.push( points.begin() + i, points.begin() + j, std::back_inserter( segments ) );
+    }
+  streaming.flush( std::back_inserter( segments ) );
+  time = clock.stopClock();
+  trace.info() << "StreamingDSSSegmentation: segments=" << segments.size() << " time=" << time << " ms"
+               << " points/s=" << 1000. * points.size() / time << endl;
+
+  const bool res = ( segments.size() == nbSegments );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -2,6 +2,8 @@
 #define __DEC_TESTS_COMMON_H__
 
 #include <list>
+#include <set>
+#include <cmath>
 
 #include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
 #include "DGtal/base/Common.h"
@@ -11,6 +13,7 @@
 #include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
 #include "DGtal/dec/CDiscreteExteriorCalculusVectorSpace.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/topology/helpers/Surfaces.h"
 
 template <typename Container>
 bool
@@ -311,6 +314,77 @@ test_derivative(int domain_size)
     }
 }
 
+template <typename Calculus, DGtal::Order order>
+bool
+test_derivative_incidences(const Calculus& calculus)
+{
+    typedef typename Calculus::KSpace KSpace;
+    typedef typename Calculus::SCells SCells;
+    typedef typename KSpace::SCells Border;
+
+    const typename Calculus::SparseMatrix derivative = calculus.template derivative<order, DGtal::PRIMAL>().myContainer;
+    const SCells& output_cells = calculus.template getIndexedSCells<order+1, DGtal::PRIMAL>();
+
+    typename Calculus::Index nnz = 0;
+    for (typename Calculus::Index index_output=0; index_output<static_cast<typename Calculus::Index>(output_cells.size()); index_output++)
+    {
+        const Border border = calculus.myKSpace.sLowerIncident(output_cells[index_output]);
+        for (typename Border::const_iterator bi=border.begin(), bie=border.end(); bi!=bie; bi++)
+        {
+            const typename Calculus::Cell cell = calculus.myKSpace.unsigns(*bi);
+            if (!calculus.containsCell(cell)) continue;
+            if (std::abs(derivative.coeff(index_output, calculus.getCellIndex(cell))) != 1) return false;
+            nnz++;
+        }
+    }
+
+    return nnz == derivative.nonZeros();
+}
+
+struct BallPredicate
+{
+    typedef DGtal::Z3i::Point Point;
+    double mySquaredRadius;
+    bool operator()(const Point& point) const
+    {
+        return point.dot(point) <= mySquaredRadius;
+    }
+};
+
+template <typename LinearAlgebraBackend>
+void
+test_dense_indexes(const double radius)
+{
+    DGtal::trace.beginBlock("testing dense indexes on ball boundary");
+
+    typedef DGtal::DiscreteExteriorCalculus<2, 3, LinearAlgebraBackend> Calculus;
+    typedef DGtal::DiscreteExteriorCalculusFactory<LinearAlgebraBackend> CalculusFactory;
+    typedef typename Calculus::KSpace KSpace;
+    typedef DGtal::Z3i::Point Point;
+
+    const Point radius_point = Point::diagonal(static_cast<DGtal::Z3i::Integer>(radius) + 2);
+    BallPredicate ball;
+    ball.mySquaredRadius = radius * radius;
+
+    KSpace kspace;
+    kspace.init(-radius_point, radius_point, true);
+    std::set<typename KSpace::SCell> surfels;
+    DGtal::Surfaces<KSpace>::sMakeBoundary(surfels, kspace, ball, -radius_point, radius_point);
+    DGtal::trace.info() << "radius=" << radius << " surfels=" << surfels.size() << std::endl;
+
+    const Calculus calculus = CalculusFactory::template createFromNSCells<2>(surfels.begin(), surfels.end());
+    DGtal::trace.info() << "cells=" << calculus.getProperties().size() << std::endl;
+
+    // the dense table must be built for a surface embedded in 3d
+    FATAL_ERROR(calculus.hasDenseIndexes());
+
+    FATAL_ERROR((test_derivative_incidences<Calculus, 0>(calculus)));
+    FATAL_ERROR((test_derivative_incidences<Calculus, 1>(calculus)));
+    FATAL_ERROR((DerivativeTester<Calculus, 0>::test(calculus)));
+
+    DGtal::trace.endBlock();
+}
+
 template <typename LinearAlgebraBackend>
 void
 test_concepts()
@@ -506,6 +580,8 @@ test_backend(const int& ntime, const int& maxdim)
 
     test_hodge_sign<LinearAlgebraBackend>();
 
+    test_dense_indexes<LinearAlgebraBackend>(10);
+
     for (int kk=0; kk<ntime; kk++)
     {
         typedef DGtal::SpaceND<1, int> Space1;
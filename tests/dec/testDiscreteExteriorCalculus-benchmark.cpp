@@ -0,0 +1,107 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculus-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of operator assembly on a large digital surface calculus.
+ * Usage: testDiscreteExteriorCalculus-benchmark [radius]
+ * The default radius gives a calculus of about 10M cells.
+ *
+ * This file is part of the DGtal library
+ */
+
+#include <cstdlib>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+
+using namespace DGtal;
+using namespace Z3i;
+using std::endl;
+
+struct BallPredicate
+{
+    typedef Z3i::Point Point;
+    double mySquaredRadius;
+    bool operator()(const Point& point) const
+    {
+        return point.dot(point) <= mySquaredRadius;
+    }
+};
+
+bool benchmark_laplace(const double radius)
+{
+    typedef DiscreteExteriorCalculus<2, 3, EigenLinearAlgebraBackend> Calculus;
+    typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+
+    trace.beginBlock("extracting ball boundary");
+    const Point radius_point = Point::diagonal(static_cast<Integer>(radius) + 2);
+    const Domain domain(-radius_point, radius_point);
+    BallPredicate ball;
+    ball.mySquaredRadius = radius * radius;
+
+    KSpace kspace;
+    kspace.init(domain.lowerBound(), domain.upperBound(), true);
+    std::set<SCell> surfels;
+    Surfaces<KSpace>::sMakeBoundary(surfels, kspace, ball, domain.lowerBound(), domain.upperBound());
+    trace.info() << "radius=" << radius << " surfels=" << surfels.size() << endl;
+    trace.endBlock();
+
+    trace.beginBlock("creating calculus");
+    const Calculus calculus = CalculusFactory::createFromNSCells<2>(surfels.begin(), surfels.end());
+    trace.info() << calculus << endl;
+    trace.info() << "cells=" << calculus.getProperties().size() << endl;
+    trace.endBlock();
+
+    trace.beginBlock("assembling derivative and hodge operators");
+    const Calculus::PrimalDerivative0 d0 = calculus.derivative<0, PRIMAL>();
+    const Calculus::PrimalHodge1 h1 = calculus.hodge<1, PRIMAL>();
+    trace.info() << "nnz(d0)=" << d0.myContainer.nonZeros() << " nnz(h1)=" << h1.myContainer.nonZeros() << endl;
+    trace.endBlock();
+
+    trace.beginBlock("assembling laplace operator");
+    const Calculus::PrimalIdentity0 laplace = calculus.laplace<PRIMAL>();
+    trace.info() << "nnz(laplace)=" << laplace.myContainer.nonZeros() << endl;
+    trace.endBlock();
+
+    // each row of the laplace operator sums to zero on a closed surface
+    const Calculus::PrimalForm0 ones(calculus, Calculus::DenseVector::Ones(calculus.kFormLength(0, PRIMAL)));
+    const double error = (laplace * ones).myContainer.array().abs().maxCoeff();
+    trace.info() << "error=" << error << endl;
+
+    return d0.myContainer.nonZeros() == 2 * calculus.kFormLength(1, PRIMAL) && error < 1e-10;
+}
+
+int main(int argc, char** argv)
+{
+    const double radius = ( argc > 1 ? std::atof(argv[1]) : 360. );
+
+    trace.beginBlock("Benchmarking DEC operator assembly");
+    const bool res = benchmark_laplace(radius);
+    trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+    trace.endBlock();
+
+    return res ? 0 : 1;
+}
@@ -275,6 +275,58 @@ void test_linear_structure()
         trace.endBlock();
     }
 
+    {
+        trace.beginBlock("reusing dirichlet solver factorization and solving several inputs");
+
+        const Calculus::PrimalIdentity0 laplace = calculus.laplace<PRIMAL>();
+        const Calculus::PrimalIdentity0 shifted_laplace = laplace + .5 * calculus.identity<0, PRIMAL>();
+
+        typedef EigenLinearAlgebraBackend::SolverSimplicialLDLT LinearAlgebraSolver;
+        typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, PRIMAL, 0, PRIMAL> Solver;
+
+        //! [solver-update]
+        Solver solver;
+        solver.compute(laplace);
+        const Calculus::PrimalForm0 solution = solver.solve(dirac);
+
+        // same sparsity pattern: only the numerical factorization is redone
+        FATAL_ERROR( solver.hasSamePattern(2. * laplace) );
+        solver.update(2. * laplace);
+        const Calculus::PrimalForm0 half_solution = solver.solve(dirac);
+        //! [solver-update]
+        trace.info() << solver.myLinearAlgebraSolver.info() << endl;
+        FATAL_ERROR( solver.myLinearAlgebraSolver.info() == Eigen::Success );
+
+        const double error_update = (2. * half_solution - solution).myContainer.array().abs().maxCoeff();
+        trace.info() << "error_update=" << error_update << endl;
+        FATAL_ERROR( error_update < 1e-8 );
+
+        // shifted operator, compared to a from scratch factorization
+        solver.update(shifted_laplace);
+        const Calculus::PrimalForm0 shifted_solution = solver.solve(dirac);
+        Solver solver_scratch;
+        solver_scratch.compute(shifted_laplace);
+        const double error_shifted = (shifted_solution - solver_scratch.solve(dirac)).myContainer.array().abs().maxCoeff();
+        trace.info() << "error_shifted=" << error_shifted << endl;
+        FATAL_ERROR( error_shifted < 1e-8 );
+
+        // several inputs solved at once
+        //! [solver-multiple-inputs]
+        Solver::InputKForms inputs;
+        for (Calculus::Index index=0; index<calculus.kFormLength(0, PRIMAL); index+=7)
+            inputs.push_back(Calculus::PrimalForm0::dirac(calculus, calculus.myKSpace.unsigns(calculus.getSCell(0, PRIMAL, index))));
+        const Solver::SolutionKForms solutions = solver.solve(inputs);
+        //! [solver-multiple-inputs]
+        FATAL_ERROR( solutions.size() == inputs.size() );
+        double error_multiple = 0;
+        for (std::size_t kk=0; kk<inputs.size(); kk++)
+            error_multiple = std::max(error_multiple, (solutions[kk] - solver.solve(inputs[kk])).myContainer.array().abs().maxCoeff());
+        trace.info() << "nb_inputs=" << inputs.size() << " error_multiple=" << error_multiple << endl;
+        FATAL_ERROR( error_multiple < 1e-10 );
+
+        trace.endBlock();
+    }
+
 }
 
 template <typename Operator>
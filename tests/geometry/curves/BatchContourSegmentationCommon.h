@@ -0,0 +1,103 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchContourSegmentationCommon.h
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Comparison of the results of a BatchContourSegmentation with the
+ * sequential segmentation and estimation of a contour, shared by
+ * testBatchMaximalSegmentation.cpp and
+ * testBatchMaximalDCASegmentation.cpp.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if !defined BatchContourSegmentationCommon_h
+/** Prevents repeated inclusion of headers. */
+#define BatchContourSegmentationCommon_h
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+
+/**
+ * Compares the results of @a batch (a BatchContourSegmentation) for
+ * contour @a c with the sequential segmentation and estimation of the
+ * range [itb,ite).
+ * @tparam SegmentComputer the segment computer used on [itb,ite).
+ * @tparam SCEstimator the estimator of the most centered segment.
+ * @param sameSegment a functor telling if a segment of the batch has
+ * the characteristics of a maximal segment.
+ * @param h the grid step of the estimations.
+ */
+template <typename SegmentComputer, typename SCEstimator,
+          typename Batch, typename SameSegment>
+bool
+compareBatchContour(const Batch& batch, std::size_t c,
+                    const typename SegmentComputer::ConstIterator& itb,
+                    const typename SegmentComputer::ConstIterator& ite,
+                    const SameSegment& sameSegment, double h)
+{
+    typedef typename SegmentComputer::ConstIterator I;
+    typedef DGtal::SaturatedSegmentation<SegmentComputer> Segmentation;
+    typedef DGtal::MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+
+    unsigned int nb = 0;
+    unsigned int nbok = 0;
+
+    SegmentComputer sc;
+    Segmentation segmentation(itb, ite, sc);
+    const std::size_t offset = batch.elementOffset(c);
+    std::size_t s = batch.segmentOffset(c);
+    for (typename Segmentation::SegmentComputerIterator it = segmentation.begin(),
+            itEnd = segmentation.end(); it != itEnd; ++it, ++s)
+    {
+        I last = it->end();
+        --last;
+        nbok += (s < batch.segmentOffset(c + 1)
+                 && batch.segments()[s].contour == c
+                 && batch.elements()[offset + batch.segments()[s].first] == *it->begin()
+                 && batch.elements()[offset + batch.segments()[s].last] == *last
+                 && sameSegment(batch.segments()[s], *it)) ? 1 : 0;
+        nb++;
+    }
+    nbok += (s == batch.segmentOffset(c + 1)) ? 1 : 0;
+    nb++;
+    DGtal::trace.info() << "(" << nbok << "/" << nb << ") segments" << std::endl;
+
+    Estimator estimator(sc, SCEstimator());
+    estimator.init(h, itb, ite);
+    std::vector<typename Batch::Estimation> estimations;
+    estimator.eval(itb, ite, std::back_inserter(estimations));
+    nbok += (estimations.size() == batch.elementOffset(c + 1) - offset
+             && std::equal(estimations.begin(), estimations.end(),
+                           batch.estimations().begin() + offset)) ? 1 : 0;
+    nb++;
+    DGtal::trace.info() << "(" << nbok << "/" << nb << ") estimations" << std::endl;
+
+    return nbok == nb;
+}
+
+#endif // !defined BatchContourSegmentationCommon_h
@@ -89,6 +89,32 @@ public:
     lmst64.eval < back_insert_iterator< vector < RealVector > > > ( curve.begin(), curve.end(),  back_inserter ( tangent ) );
     return true;
   }
+  bool lambda64InParallel()
+  {
+    Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
+    LambdaMST2D < Segmentation > lmst64;
+    lmst64.attach ( segmenter );
+    lmst64.init ( curve.begin(), curve.end() );
+    std::vector < RealVector > tangent;
+    lmst64.eval ( curve.begin(), curve.end(), back_inserter ( tangent ) );
+    unsigned int nb = 0, nbok = 0;
+    const unsigned int chunks[] = { 0, 1, 2, 3, 7, 64 };
+    for ( unsigned int c = 0; c < 6; c++ )
+    {
+      std::vector < RealVector > parallelTangent;
+      lmst64.evalInParallel ( curve.begin(), curve.end(), back_inserter ( parallelTangent ), chunks[ c ] );
+      nbok += ( parallelTangent == tangent ) ? 1 : 0;
+      nb++;
+    }
+    // sub range
+    std::vector < RealVector > subTangent, parallelSubTangent;
+    lmst64.eval ( curve.begin() + 10, curve.end() - 10, back_inserter ( subTangent ) );
+    lmst64.evalInParallel ( curve.begin() + 10, curve.end() - 10, back_inserter ( parallelSubTangent ), 4 );
+    nbok += ( parallelSubTangent == subTangent ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ")" << std::endl;
+    return nbok == nb;
+  }
 };
 
 
@@ -106,6 +132,9 @@ int main( int , char**  )
         trace.beginBlock ( "Testing calculation for whole curve" );
            res &= testLMST.lambda64();
         trace.endBlock();
+        trace.beginBlock ( "Testing parallel calculation for whole curve" );
+           res &= testLMST.lambda64InParallel();
+        trace.endBlock();
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
     return res ? 0 : 1;
@@ -60,6 +60,7 @@
 #include "DGtal/geometry/curves/estimation/MLPLengthEstimator.h"
 #include "DGtal/geometry/curves/estimation/FPLengthEstimator.h"
 #include "DGtal/geometry/curves/estimation/DSSLengthEstimator.h"
+#include "DGtal/geometry/curves/estimation/BatchMLPLengthEstimator.h"
 
 #include "ConfigTest.h"
 
@@ -289,6 +290,88 @@ bool testDisplay(double radius, double h)
   return true;
 }
 
+/**
+ * Compares BatchMLPLengthEstimator with MLPLengthEstimator and 
+ * FPLengthEstimator on the contours of several balls. 
+ */
+bool testBatchMLPLengthEstimator(double h)
+{
+  typedef Z2i::Space::Point Point;
+  typedef Z2i::KSpace KSpace;
+  typedef std::vector<Point> Contour; 
+  typedef Circulator<Contour::const_iterator> ConstCirculator; 
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Batch MLP and FP length estimation" );
+
+  std::vector<Contour> contours; 
+  for (unsigned int i = 0; i < 40; ++i)
+    {
+      const double radius = 1.5 + 0.75*i; 
+      Ball2D<Z2i::Space> ball( Z2i::RealPoint( 0.3*i, -0.2*i ), radius );
+      GaussDigitizer<Z2i::Space, Ball2D<Z2i::Space> > dig;
+      dig.attach( ball );
+      dig.init( ball.getLowerBound() - Z2i::RealPoint(1,1), 
+                ball.getUpperBound() + Z2i::RealPoint(1,1), 1.0 );
+      KSpace K;
+      K.init( dig.getLowerBound(), dig.getUpperBound(), true );
+      SurfelAdjacency<KSpace::dimension> SAdj( true );
+      KSpace::SCell bel = Surfaces<KSpace>::findABel( K, dig, 10000 );
+      contours.push_back( Contour() ); 
+      Surfaces<KSpace>::track2DBoundaryPoints( contours.back(), K, SAdj, dig, bel );
+    }
+
+  BatchMLPLengthEstimator<Z2i::Integer> batch; 
+  //twice, to reuse the buffers
+  for (unsigned int k = 0; k < 2; ++k)
+    {
+      batch.init( h, contours.begin() + k, contours.end() ); 
+      nbok += ( batch.isValid() && batch.size() == contours.size() - k ) ? 1 : 0; 
+      nb++;
+      for (unsigned int i = 0; i < batch.size(); ++i)
+        {
+          const Contour& c = contours[ i + k ]; 
+          ConstCirculator circ( c.begin(), c.begin(), c.end() ); 
+          MLPLengthEstimator<ConstCirculator> MLPlength; 
+          MLPlength.init( h, circ, circ, true ); 
+          FPLengthEstimator<ConstCirculator> FPlength; 
+          FPlength.init( h, circ, circ, true ); 
+          FP<ConstCirculator, Z2i::Integer, 4> theFP( circ, circ ); 
+          std::vector<Z2i::RealPoint> mlp; 
+          theFP.copyMLP( std::back_inserter( mlp ) ); 
+          nbok += ( batch.eval( i ) == MLPlength.eval() 
+                    && batch.evalFP( i ) == FPlength.eval() 
+                    && batch.lengths()[ i ] == batch.eval( i ) 
+                    && batch.mlp( i ) == mlp 
+                    && std::equal( theFP.polygon().begin(), theFP.polygon().end(), 
+                                   batch.fp( i ).begin() ) 
+                    && batch.fp( i ).size() == theFP.size() ) ? 1 : 0; 
+          nb++;
+        }
+    }
+  trace.info() << batch << " (" << nbok << "/" << nb << ")" << std::endl;
+
+  //disconnected curve
+  contours[ 3 ].erase( contours[ 3 ].begin() + 5 ); 
+  bool hasThrown = false; 
+  try 
+    {
+      batch.init( h, contours.begin(), contours.end() ); 
+    }
+  catch ( InputException& )
+    {
+      hasThrown = true; 
+    }
+  nbok += hasThrown ? 1 : 0; 
+  nb++;
+  
+  trace.info() << "(" << nbok << "/" << nb << ")" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -306,7 +389,8 @@ int main( int argc, char** argv )
     && testLengthEstimatorsOnBall(r,0.01)
     && testLengthEstimatorsOnBall(r,0.001)
     && testLengthEstimatorsOnBall(r,0.0001)
-    && testDisplay(r,0.9);
+    && testDisplay(r,0.9)
+    && testBatchMLPLengthEstimator(0.1);
   ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,179 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchMaximalDCASegmentation.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class BatchMaximalDCASegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/parametric/Ball2D.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/BatchMaximalDCASegmentation.h"
+#include "ConfigTest.h"
+#include "BatchContourSegmentationCommon.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef BatchMaximalDCASegmentation<int> Batch;
+typedef Z2i::KSpace KSpace;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchMaximalDCASegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return the boundary of the Gauss digitization of @a aShape, which
+ * must lie in the space @a K.
+ */
+template <typename Shape>
+GridCurve<KSpace> digitizeBoundary( const KSpace & K, const Shape & aShape, double h )
+{
+  GaussDigitizer<Z2i::Space, Shape> dig;
+  dig.attach( aShape );
+  dig.init( aShape.getLowerBound(), aShape.getUpperBound(), h );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  const KSpace::SCell bel = Surfaces<KSpace>::findABel( K, dig, 10000 );
+  std::vector<Z2i::Point> points;
+  Surfaces<KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+  GridCurve<KSpace> curve( K );
+  curve.initFromVector( points );
+  return curve;
+}
+
+/**
+ * Tells if a segment of the batch has the straightness and the
+ * curvature of a maximal DCA.
+ */
+struct SameDCA
+{
+  template <typename SegmentComputer>
+  bool operator()( const Batch::Segment & segment, const SegmentComputer & sc ) const
+  {
+    return segment.isStraight == sc.isStraight()
+      && segment.curvature == ( sc.isStraight() ? 0.0
+                                : sc.getSeparatingCircle().getCurvature() );
+  }
+};
+
+/**
+ * Compares the results of the batch for contour @a c with the
+ * sequential segmentation and estimation of the range [itb,ite).
+ */
+template <typename I>
+bool compareContour( const Batch & batch, std::size_t c,
+                     const I & itb, const I & ite, double h )
+{
+  typedef StabbingCircleComputer<I> SegmentComputer;
+  typedef CurvatureFromDCAEstimator<SegmentComputer> SCEstimator;
+  return compareBatchContour<SegmentComputer, SCEstimator>( batch, c, itb, ite,
+                                                            SameDCA(), h );
+}
+
+/**
+ * Batch segmentation of closed and open grid curves.
+ */
+bool testBatchMaximalDCASegmentation()
+{
+  typedef GridCurve<KSpace>::IncidentPointsRange Range;
+
+  trace.beginBlock( "Batch DCA segmentation of grid curves" );
+
+  const double h = 1.0;
+  KSpace K;
+  K.init( Z2i::Point( -100, -100 ), Z2i::Point( 100, 100 ), true );
+  std::vector< GridCurve<KSpace> > curves;
+  curves.push_back( digitizeBoundary( K, Ball2D<Z2i::Space>( 0.3, -0.2, 17.3 ), h ) );
+  curves.push_back( digitizeBoundary( K, Ball2D<Z2i::Space>( 2.5, 1.5, 4.2 ), h ) );
+  curves.push_back( digitizeBoundary( K, Flower2D<Z2i::Space>( 0.5, -2.3, 15.0, 3.0, 5, 0.3 ), h ) );
+  std::ifstream instream( ( testPath + "samples/sinus2D4.dat" ).c_str() );
+  GridCurve<KSpace> open;
+  open.initFromVectorStream( instream );
+  curves.push_back( open );
+
+  Batch batch;
+  for ( unsigned int i = 0; i < curves.size(); ++i )
+    batch.addContour( curves[ i ] );
+  batch.compute( h );
+  trace.info() << batch << std::endl;
+
+  bool res = batch.isValid() && batch.size() == curves.size()
+    && batch.curvatures().size() == batch.pairs().size()
+    && curves[ 0 ].isClosed() && ! curves[ 3 ].isClosed();
+
+  for ( unsigned int i = 0; i < curves.size(); ++i )
+    {
+      Range r = curves[ i ].getIncidentPointsRange();
+      res = res && ( batch.isClosed( i ) == curves[ i ].isClosed() );
+      if ( curves[ i ].isClosed() )
+        res = res && compareContour( batch, i, r.c(), r.c(), h );
+      else
+        res = res && compareContour( batch, i, r.begin(), r.end(), h );
+    }
+
+  // without curvatures, after a clear
+  const std::size_t nbSegments = batch.segments().size();
+  batch.clear();
+  res = res && batch.size() == 0 && batch.pairs().empty();
+  for ( unsigned int i = 0; i < curves.size(); ++i )
+    batch.addContour( curves[ i ] );
+  batch.compute( h, false );
+  res = res && batch.curvatures().empty()
+    && batch.segments().size() == nbSegments
+    && batch.segmentOffset( batch.size() ) == batch.segments().size();
+
+  trace.info() << ( res ? "ok" : "not ok" ) << std::endl;
+  trace.endBlock();
+  return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BatchMaximalDCASegmentation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBatchMaximalDCASegmentation(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,218 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchMaximalSegmentation-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of BatchMaximalSegmentation and BatchMaximalDCASegmentation
+ * against the segmentation and estimation of contours one at a time,
+ * in contours per second.
+ * Usage: testBatchMaximalSegmentation-benchmark [nbContours] [nbDCAContours]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/BatchMaximalSegmentation.h"
+#include "DGtal/geometry/curves/BatchMaximalDCASegmentation.h"
+#include "DGtal/geometry/curves/estimation/SegmentComputerEstimators.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/**
+ * Maximal DSSs and tangents of translated copies of sample Freeman
+ * chains.
+ */
+bool benchmarkDSS( unsigned int nbContours )
+{
+  typedef BatchMaximalSegmentation<int> Batch;
+  typedef Batch::Points Points;
+  typedef Circulator<Points::const_iterator> ConstCirculator;
+
+  trace.beginBlock( "BatchMaximalSegmentation" );
+
+  // contours: translated copies of sample Freeman chains
+  std::vector< FreemanChain<int> > chains;
+  const std::string chainFiles[] = { "samples/SmallBall.fc", "samples/SmallBall2.fc", "samples/contourS.fc" };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      std::ifstream instream( ( testPath + chainFiles[ i ] ).c_str() );
+      chains.push_back( FreemanChain<int>( instream ) );
+    }
+
+  std::vector<Points> contours( nbContours );
+  std::size_t nbPoints = 0;
+  for ( unsigned int c = 0; c < nbContours; ++c )
+    {
+      const FreemanChain<int> & fc = chains[ c % chains.size() ];
+      const Batch::Vector shift( c % 97, c / 97 );
+      for ( FreemanChain<int>::ConstIterator it = fc.begin(); it != fc.end(); ++it )
+        contours[ c ].push_back( *it + shift );
+      contours[ c ].pop_back(); // closed chains repeat their first point
+      nbPoints += contours[ c ].size();
+    }
+  trace.info() << "contours=" << nbContours << " points=" << nbPoints << endl;
+
+  Clock clock;
+  double time;
+
+  // one contour at a time
+  typedef ArithmeticalDSSComputer<ConstCirculator, int, 4> SegmentComputer;
+  typedef SaturatedSegmentation<SegmentComputer> Segmentation;
+  typedef TangentVectorFromDSSEstimator<SegmentComputer> SCEstimator;
+  typedef MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+
+  clock.startClock();
+  std::size_t nbSegments = 0;
+  std::vector<Batch::Vector> tangents;
+  for ( unsigned int c = 0; c < nbContours; ++c )
+    {
+      ConstCirculator circ( contours[ c ].begin(), contours[ c ].begin(), contours[ c ].end() );
+      SegmentComputer sc;
+      Segmentation segmentation( circ, circ, sc );
+      for ( Segmentation::SegmentComputerIterator it = segmentation.begin(),
+              itEnd = segmentation.end(); it != itEnd; ++it )
+        ++nbSegments;
+      Estimator estimator( sc, SCEstimator() );
+      estimator.init( 1.0, circ, circ );
+      tangents.clear();
+      estimator.eval( circ, circ, std::back_inserter( tangents ) );
+    }
+  time = clock.stopClock();
+  trace.info() << "one at a time: segments=" << nbSegments << " time=" << time << " ms"
+               << " contours/s=" << 1000. * nbContours / time << endl;
+
+  // batch
+  clock.startClock();
+  Batch batch;
+  for ( unsigned int c = 0; c < nbContours; ++c )
+    batch.addContour( contours[ c ].begin(), contours[ c ].end(), true );
+  batch.compute();
+  time = clock.stopClock();
+  trace.info() << "batch: segments=" << batch.segments().size() << " time=" << time << " ms"
+               << " contours/s=" << 1000. * nbContours / time << endl;
+
+  trace.endBlock();
+  return ( batch.segments().size() == nbSegments )
+    && ( batch.tangents().size() == nbPoints );
+}
+
+/**
+ * Maximal DCAs and curvatures of the boundaries of flowers of various
+ * sizes, like the contours of the slices of a 3D shape.
+ */
+bool benchmarkDCA( unsigned int nbContours )
+{
+  typedef BatchMaximalDCASegmentation<int> Batch;
+  typedef Z2i::KSpace KSpace;
+  typedef GridCurve<KSpace> Curve;
+  typedef Curve::IncidentPointsRange Range;
+  typedef Flower2D<Z2i::Space> Shape;
+
+  trace.beginBlock( "BatchMaximalDCASegmentation" );
+
+  KSpace K;
+  K.init( Z2i::Point( -100, -100 ), Z2i::Point( 100, 100 ), true );
+  std::vector<Curve> curves;
+  std::size_t nbEdges = 0;
+  for ( unsigned int c = 0; c < nbContours; ++c )
+    {
+      const Shape flower( 0.0, 0.0, 10.0 + c % 40, 2.0, 3 + c % 4, 0.1 * c );
+      GaussDigitizer<Z2i::Space, Shape> dig;
+      dig.attach( flower );
+      dig.init( flower.getLowerBound(), flower.getUpperBound(), 1.0 );
+      SurfelAdjacency<KSpace::dimension> SAdj( true );
+      const KSpace::SCell bel = Surfaces<KSpace>::findABel( K, dig, 100000 );
+      std::vector<Z2i::Point> points;
+      Surfaces<KSpace>::track2DBoundaryPoints( points, K, SAdj, dig, bel );
+      Curve curve( K );
+      curve.initFromVector( points );
+      curves.push_back( curve );
+      nbEdges += curve.size();
+    }
+  trace.info() << "contours=" << nbContours << " edges=" << nbEdges << endl;
+
+  Clock clock;
+  double time;
+
+  // one contour at a time, on the grid curves
+  typedef StabbingCircleComputer<Range::ConstCirculator> SegmentComputer;
+  typedef CurvatureFromDCAEstimator<SegmentComputer> SCEstimator;
+  typedef MostCenteredMaximalSegmentEstimator<SegmentComputer, SCEstimator> Estimator;
+
+  clock.startClock();
+  std::vector<double> curvatures;
+  std::size_t nbCurvatures = 0;
+  for ( unsigned int c = 0; c < nbContours; ++c )
+    {
+      Range r = curves[ c ].getIncidentPointsRange();
+      SegmentComputer sc;
+      Estimator estimator( sc, SCEstimator() );
+      estimator.init( 1.0, r.c(), r.c() );
+      curvatures.clear();
+      estimator.eval( r.c(), r.c(), std::back_inserter( curvatures ) );
+      nbCurvatures += curvatures.size();
+    }
+  time = clock.stopClock();
+  trace.info() << "one at a time: time=" << time << " ms"
+               << " contours/s=" << 1000. * nbContours / time << endl;
+
+  // batch
+  clock.startClock();
+  Batch batch;
+  for ( unsigned int c = 0; c < nbContours; ++c )
+    batch.addContour( curves[ c ] );
+  batch.compute();
+  time = clock.stopClock();
+  trace.info() << "batch: segments=" << batch.segments().size() << " time=" << time << " ms"
+               << " contours/s=" << 1000. * nbContours / time << endl;
+
+  trace.endBlock();
+  return ( batch.curvatures().size() == nbCurvatures )
+    && ( nbCurvatures == nbEdges );
+}
+
+int main( int argc, char** argv )
+{
+  const unsigned int nbContours = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 20000;
+  const unsigned int nbDCAContours = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 200;
+
+  const bool res = benchmarkDSS( nbContours ) && benchmarkDCA( nbDCAContours );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
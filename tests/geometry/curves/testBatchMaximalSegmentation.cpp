@@ -0,0 +1,172 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchMaximalSegmentation.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class BatchMaximalSegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/BatchMaximalSegmentation.h"
+#include "ConfigTest.h"
+#include "BatchContourSegmentationCommon.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef BatchMaximalSegmentation<int> Batch;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchMaximalSegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Tells if a segment of the batch has the DSL characteristics of a
+ * maximal DSS.
+ */
+struct SameDSS
+{
+  template <typename SegmentComputer>
+  bool operator()( const Batch::Segment & segment, const SegmentComputer & sc ) const
+  {
+    return segment.a == sc.a() && segment.b == sc.b() && segment.mu == sc.mu();
+  }
+};
+
+/**
+ * Compares the results of the batch for contour @a c with the
+ * sequential segmentation and estimation of the range [itb,ite).
+ */
+template <typename I>
+bool compareContour( const Batch & batch, std::size_t c,
+                     const I & itb, const I & ite )
+{
+  typedef typename IteratorCirculatorTraits<I>::Value::Coordinate Coordinate;
+  typedef ArithmeticalDSSComputer<I, Coordinate, 4> SegmentComputer;
+  typedef TangentVectorFromDSSEstimator<SegmentComputer> SCEstimator;
+  return compareBatchContour<SegmentComputer, SCEstimator>( batch, c, itb, ite,
+                                                            SameDSS(), 1.0 );
+}
+
+/**
+ * Batch segmentation of grid curves and Freeman chains.
+ */
+bool testBatchMaximalSegmentation()
+{
+  typedef KhalimskySpaceND<2> KSpace;
+  typedef GridCurve<KSpace>::PointsRange Range;
+
+  trace.beginBlock( "Batch segmentation of grid curves and Freeman chains" );
+
+  std::vector< GridCurve<KSpace> > curves;
+  const std::string curveFiles[] = { "samples/sinus2D4.dat", "samples/smallSquare.dat", "samples/DSS.dat" };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      std::ifstream instream( ( testPath + curveFiles[ i ] ).c_str() );
+      GridCurve<KSpace> curve;
+      curve.initFromVectorStream( instream );
+      curves.push_back( curve );
+    }
+
+  std::vector< FreemanChain<int> > chains;
+  const std::string chainFiles[] = { "samples/SmallBall.fc", "samples/contourS.fc", "samples/france.fc" };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      std::ifstream instream( ( testPath + chainFiles[ i ] ).c_str() );
+      chains.push_back( FreemanChain<int>( instream ) );
+    }
+
+  Batch batch;
+  for ( unsigned int i = 0; i < curves.size(); ++i )
+    batch.addContour( curves[ i ] );
+  for ( unsigned int i = 0; i < chains.size(); ++i )
+    batch.addContour( chains[ i ] );
+  batch.compute();
+  trace.info() << batch << std::endl;
+
+  bool res = batch.isValid() && batch.size() == 6
+    && batch.tangents().size() == batch.points().size();
+
+  for ( unsigned int i = 0; i < curves.size(); ++i )
+    {
+      Range r = curves[ i ].getPointsRange();
+      res = res && ( batch.isClosed( i ) == curves[ i ].isClosed() );
+      if ( curves[ i ].isClosed() )
+        res = res && compareContour( batch, i, r.c(), r.c() );
+      else
+        res = res && compareContour( batch, i, r.begin(), r.end() );
+    }
+
+  for ( unsigned int i = 0; i < chains.size(); ++i )
+    {
+      const std::size_t c = curves.size() + i;
+      std::vector<Batch::Point> points;
+      FreemanChain<int>::getContourPoints( chains[ i ], points );
+      if ( chains[ i ].isClosed() )
+        {
+          points.pop_back();
+          Circulator< std::vector<Batch::Point>::const_iterator >
+            circ( points.begin(), points.begin(), points.end() );
+          res = res && batch.isClosed( c ) && compareContour( batch, c, circ, circ );
+        }
+      else
+        res = res && compareContour( batch, c, points.cbegin(), points.cend() );
+    }
+
+  // without tangents
+  batch.compute( false );
+  res = res && batch.tangents().empty()
+    && batch.segmentOffset( batch.size() ) == batch.segments().size();
+
+  trace.info() << ( res ? "ok" : "not ok" ) << std::endl;
+  trace.endBlock();
+  return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BatchMaximalSegmentation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBatchMaximalSegmentation(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
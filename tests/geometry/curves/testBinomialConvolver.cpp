@@ -29,6 +29,10 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/geometry/curves/BinomialConvolver.h"
@@ -107,6 +111,79 @@ bool testBinomialConvolver()
   return true;
 }
 
+/**
+ * @return 'true' if both values are equal up to a relative error.
+ */
+bool close( double a, double b )
+{
+  return std::fabs( a - b ) <= 1e-9 * ( 1.0 + std::max( std::fabs( a ), std::fabs( b ) ) );
+}
+
+/**
+ * Compares IndexedBinomialConvolver with BinomialConvolver on
+ * the given points, for several kernel sizes, on open and closed
+ * contours. Checks also the mapping from iterators to indices.
+ */
+template <typename Points>
+bool compareConvolvers( const Points & points )
+{
+  typedef typename Points::const_iterator ConstIteratorOnPoints;
+  typedef BinomialConvolver<ConstIteratorOnPoints, double> MyBinomialConvolver;
+  typedef IndexedBinomialConvolver<double> MyIndexedBinomialConvolver;
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  const int nbPoints = (int) points.size();
+  MyIndexedBinomialConvolver ibc;
+  for ( unsigned int n = 0; n < 13; n += 3 )
+    for ( unsigned int c = 0; c < 2; ++c )
+      {
+        const bool isClosed = ( c == 0 );
+        MyBinomialConvolver bc( n );
+        bc.init( 0.5, points.begin(), points.end(), isClosed );
+        ibc.setSize( n );
+        ibc.init( 0.5, points.begin(), points.end(), isClosed );
+        std::vector<double> curvatures;
+        ibc.curvatures( std::back_inserter( curvatures ) );
+        bool ok = ibc.isValid() && ( (int) ibc.nbPoints() == nbPoints )
+          && ( (int) curvatures.size() == nbPoints );
+        int i = 0;
+        for ( ConstIteratorOnPoints it = points.begin(); it != points.end(); ++it, ++i )
+          ok = ok && ( bc.index( it ) == i )
+            && close( bc.curvature( i ), curvatures[ i ] );
+        // includes indices outside the contour
+        for ( i = -(int) n - 3; i < nbPoints + (int) n + 3; ++i )
+          ok = ok
+            && close( bc.x( i ).first, ibc.x( i ).first )
+            && close( bc.x( i ).second, ibc.x( i ).second )
+            && close( bc.dx( i ).first, ibc.dx( i ).first )
+            && close( bc.dx( i ).second, ibc.dx( i ).second )
+            && close( bc.d2x( i ).first, ibc.d2x( i ).first )
+            && close( bc.d2x( i ).second, ibc.d2x( i ).second )
+            && close( bc.curvature( i ), ibc.curvature( i ) );
+        nbok += ok ? 1 : 0;
+        nb++;
+      }
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbPoints << " points" << std::endl;
+  return nbok == nb;
+}
+
+bool testIndexedBinomialConvolver()
+{
+  trace.beginBlock ( "Testing IndexedBinomialConvolver ..." );
+  typedef PointVector<2, double> RealPoint;
+  bool res = true;
+  for ( unsigned int nbPoints = 1; nbPoints < 100; nbPoints += 7 )
+    {
+      std::vector< RealPoint > points;
+      for ( unsigned int i = 0; i < nbPoints; ++i )
+        points.push_back( RealPoint( { 10.0 * std::cos( 0.1 * i ) + ( rand() % 3 ),
+                                       5.0 * std::sin( 0.1 * i ) + ( rand() % 3 ) } ) );
+      res = res && compareConvolvers( points );
+    }
+  trace.endBlock();
+  return res;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -118,7 +195,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testBinomialConvolver(); // && ... other tests
+  bool res = testBinomialConvolver() && testIndexedBinomialConvolver(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -32,6 +32,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <map>
+#include <vector>
 #include "DGtal/geometry/curves/DSLSubsegment.h"
 #include "DGtal/arithmetic/StandardDSLQ0.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -202,6 +203,94 @@ bool testDSLSubsegment(Integer modb)
 }
 
 
+/**
+ * Compares the batch services of DSLSubsegment and StandardDSLQ0 with
+ * their one query counterparts, on the subsegments of several DSLs.
+ * SmartDSS is only checked when @a withSmartDSS is 'true', since it
+ * requires SternBrocot fractions.
+ */
+template <typename Integer,typename Fraction>
+bool testBatch(Integer modb, bool withSmartDSS)
+{
+  typedef DGtal::DSLSubsegment<Integer,Integer> DSLSubseg;
+  typedef typename DSLSubseg::Point Point;
+  typedef StandardDSLQ0<Fraction> DSL;
+  typedef typename DSL::Point PointDSL;
+
+  DGtal::IntegerComputer<Integer> ic;
+  std::vector<typename DSLSubseg::Query> queries;
+  std::vector<DSL> lines;
+  typename DSL::SubsegmentQueries dslQueries;
+
+  trace.beginBlock("Compare batch and one query subsegment computations");
+  for(unsigned int n = 0; n < 20; n++)
+    {
+      Integer b( rand() % modb +1);
+      Integer a( rand() % b +1);
+      while(ic.gcd(a,b) !=1)
+        a = rand() %b +1;
+      Integer mu = rand() % (2*modb);
+      Integer xf = rand() % modb;
+      lines.push_back( DSL( a, b, mu ) );
+      for(unsigned int k = 0; k < 50; k++)
+        {
+          Integer x1 = xf + rand() % 100;
+          Integer x2 = x1 + 1 + rand() % 100;
+          typename DSLSubseg::Query q;
+          q.a = a; q.b = b; q.mu = mu;
+          q.A = Point(x1,ic.floorDiv(a*x1+mu,b));
+          q.B = Point(x2,ic.floorDiv(a*x2+mu,b));
+          queries.push_back( q );
+          // Queries of the DSLs are interleaved.
+          typename DSL::SubsegmentQuery dq;
+          dq.line = lines.size() - 1 - ( k % lines.size() );
+          dq.A = lines[ dq.line ].lowestY( x1 );
+          dq.B = lines[ dq.line ].lowestY( x2 );
+          dslQueries.push_back( dq );
+        }
+    }
+
+  int error = 0;
+  std::vector<typename DSLSubseg::Characteristics> farey, localCH;
+  DSLSubseg::batch(queries,farey,"farey");
+  DSLSubseg::batch(queries,localCH,"localCH");
+  for(unsigned int i = 0; i < queries.size(); i++)
+    {
+      Point A = queries[i].A;
+      Point B = queries[i].B;
+      DSLSubseg D(queries[i].a,queries[i].b,queries[i].mu,A,B,"farey");
+      if(farey[i].a != D.getA() || farey[i].b != D.getB() || farey[i].mu != D.getMu()
+         || localCH[i].a != D.getA() || localCH[i].b != D.getB() || localCH[i].mu != D.getMu())
+        error++;
+    }
+
+  std::vector<DSL> smart, reversed;
+  if(withSmartDSS)
+    DSL::batchSmartDSS(lines,dslQueries,smart);
+  DSL::batchReversedSmartDSS(lines,dslQueries,reversed);
+  for(unsigned int i = 0; i < dslQueries.size(); i++)
+    {
+      const DSL & D = lines[ dslQueries[i].line ];
+      const PointDSL & A = dslQueries[i].A;
+      const PointDSL & B = dslQueries[i].B;
+      DSL S = D.reversedSmartDSS(A,B);
+      if(!(reversed[i].a() == S.a() && reversed[i].b() == S.b() && reversed[i].mu() == S.mu()))
+        error++;
+      if(withSmartDSS)
+        {
+          S = D.smartDSS(A,B);
+          if(!(smart[i].a() == S.a() && smart[i].b() == S.b() && smart[i].mu() == S.mu()))
+            error++;
+        }
+    }
+  trace.info() << error << " errors over " << queries.size() + dslQueries.size()
+               << " queries." << std::endl;
+  trace.endBlock();
+  trace.info() << std::endl;
+
+  return error==0;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
@@ -218,7 +307,9 @@ int main()
   Integer i = 1000;
   srand(time(NULL));
   
-  bool res = testDSLSubsegment<Integer,Fraction>(i);
+  bool res = testDSLSubsegment<Integer,Fraction>(i)
+    && testBatch<Integer,Fraction>(i,false)
+    && testBatch<Integer,SternBrocot<Integer,DGtal::int32_t>::Fraction>(i,true);
   
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
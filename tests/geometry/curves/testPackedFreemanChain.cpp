@@ -0,0 +1,197 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef FreemanChain<int> FC;
+typedef PackedFreemanChain<int> PFC;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares a packed chain with the Freeman chain it comes from.
+ */
+bool compareChains( const FC & fc, const PFC & pfc )
+{
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+
+  nbok += ( pfc.isValid() && pfc.size() == fc.size() && pfc.toFreemanChain() == fc ) ? 1 : 0;
+  nb++;
+
+  // points
+  std::vector<PFC::Point> points, packedPoints, iteratedPoints;
+  FC::getContourPoints( fc, points );
+  pfc.getPoints( std::back_inserter( packedPoints ) );
+  for ( PFC::ConstIterator it = pfc.begin(), itEnd = pfc.end(); it != itEnd; ++it )
+    iteratedPoints.push_back( *it );
+  nbok += ( points == packedPoints && points == iteratedPoints ) ? 1 : 0;
+  nb++;
+
+  // displacement and bounding box
+  int min_x, min_y, max_x, max_y;
+  int pmin_x, pmin_y, pmax_x, pmax_y;
+  fc.computeBoundingBox( min_x, min_y, max_x, max_y );
+  pfc.computeBoundingBox( pmin_x, pmin_y, pmax_x, pmax_y );
+  nbok += ( pfc.totalDisplacement() == fc.totalDisplacement()
+            && pfc.lastPoint() == fc.lastPoint()
+            && min_x == pmin_x && min_y == pmin_y
+            && max_x == pmax_x && max_y == pmax_y ) ? 1 : 0;
+  nb++;
+
+  // turns
+  PFC::Size nbCcw = 0, nbCw = 0, nbUTurns = 0;
+  for ( unsigned int i = 0; i + 1 < fc.size(); ++i )
+    {
+      const int diff = ( fc.code( i + 1 ) - fc.code( i ) + 4 ) % 4;
+      nbCcw += ( diff == 1 ) ? 1 : 0;
+      nbCw += ( diff == 3 ) ? 1 : 0;
+      nbUTurns += ( diff == 2 ) ? 1 : 0;
+    }
+  if ( fc.size() > 1 && fc.firstPoint() == fc.lastPoint() )
+    {
+      const int diff = ( fc.code( 0 ) - fc.code( fc.size() - 1 ) + 4 ) % 4;
+      nbCcw += ( diff == 1 ) ? 1 : 0;
+      nbCw += ( diff == 3 ) ? 1 : 0;
+      nbUTurns += ( diff == 2 ) ? 1 : 0;
+    }
+  PFC::Size pnbCcw, pnbCw, pnbUTurns;
+  pfc.countTurns( pnbCcw, pnbCw, pnbUTurns );
+  nbok += ( nbCcw == pnbCcw && nbCw == pnbCw && nbUTurns == pnbUTurns ) ? 1 : 0;
+  nb++;
+  if ( fc.size() > 0 && fc.isClosed() )
+    {
+      nbok += ( pfc.ccwLoops() == fc.ccwLoops() ) ? 1 : 0;
+      nb++;
+    }
+
+  // streams
+  std::ostringstream out, pout;
+  FC::write( out, fc );
+  PFC::write( pout, pfc );
+  std::istringstream in( pout.str() );
+  nbok += ( out.str() == pout.str() && PFC( in ) == pfc ) ? 1 : 0;
+  nb++;
+
+  trace.info() << pfc << " (" << nbok << "/" << nb << ")" << std::endl;
+  return nbok == nb;
+}
+
+/**
+ * Packed chains of sample files and of chains of various lengths.
+ */
+bool testPackedFreemanChain()
+{
+  trace.beginBlock( "Comparison with FreemanChain" );
+  bool res = true;
+
+  const std::string files[] = { "samples/SmallBall.fc", "samples/contourS.fc",
+                                "samples/france.fc", "samples/klokan.fc" };
+  for ( unsigned int i = 0; i < 4; ++i )
+    {
+      std::ifstream instream( ( testPath + files[ i ] ).c_str() );
+      FC fc( instream );
+      std::ifstream pinstream( ( testPath + files[ i ] ).c_str() );
+      PFC pfc( pinstream );
+      res = res && ( pfc == PFC( fc ) ) && compareChains( fc, pfc );
+    }
+
+  // all lengths around the size of a byte and of a word
+  const std::string codes = "0001011121223233300300112303221";
+  for ( unsigned int n = 1; n < 70; ++n )
+    {
+      std::string s;
+      for ( unsigned int i = 0; i < n; ++i )
+        s += codes[ ( 7 * i ) % codes.size() ];
+      FC fc( s, n, -3 );
+      res = res && compareChains( fc, PFC( fc ) );
+    }
+
+  // closed chain with a U-turn
+  FC fc( "0011022233", 0, 0 );
+  res = res && compareChains( fc, PFC( fc ) ) && PFC( fc ).ccwLoops() == 0;
+
+  trace.info() << ( res ? "ok" : "not ok" ) << std::endl;
+  trace.endBlock();
+  return res;
+}
+
+/**
+ * Reading several chains with comments from a stream.
+ */
+bool testStreams()
+{
+  trace.beginBlock( "Reading several chains" );
+  std::istringstream in( "# two chains\n\n  3 4 0123\n# comment\n-1 -2 3\t\n5 6\n" );
+  PFC c1, c2, c3, c4;
+  const bool r1 = PFC::read( in, c1 );
+  const bool r2 = PFC::read( in, c2 );
+  const bool r3 = PFC::read( in, c3 );
+  const bool r4 = PFC::read( in, c4 );
+  const bool res = r1 && r2 && r3 && ! r4
+    && c1.firstPoint() == PFC::Point( 3, 4 ) && c1.size() == 4 && c1.isClosed()
+    && c2.firstPoint() == PFC::Point( -1, -2 ) && c2.size() == 1 && c2.code( 0 ) == 3
+    && c3.firstPoint() == PFC::Point( 5, 6 ) && c3.size() == 0;
+  trace.info() << ( res ? "ok" : "not ok" ) << std::endl;
+  trace.endBlock();
+  return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PackedFreemanChain" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testPackedFreemanChain() && testStreams(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -935,6 +935,82 @@ bool SaturatedSegmentationTest()
   return (compteur == 4295);
 }
 
+/**
+ * Compares the divide-and-conquer saturated segmentation
+ * with the sequential one
+ */
+template <typename Segmentation>
+bool compareInParallel(const Segmentation& s, unsigned int nbChunks)
+{
+  typedef typename Segmentation::SegmentComputer SegmentComputer;
+  std::vector<SegmentComputer> segments;
+  s.computeInParallel(segments, nbChunks);
+
+  unsigned int nb = 0;
+  bool res = true;
+  typename Segmentation::SegmentComputerIterator i = s.begin();
+  typename Segmentation::SegmentComputerIterator end = s.end();
+  for ( ; (i != end) && (nb < segments.size()); ++i, ++nb)
+    res = res && (*i == segments[nb]);
+  res = res && (i == end) && (nb == segments.size());
+
+  trace.info() << nbChunks << " chunks, " << segments.size() << " segments: "
+               << (res ? "ok" : "not ok") << endl;
+  return res;
+}
+
+/**
+ * Divide-and-conquer saturated segmentation of a long open curve
+ */
+bool SaturatedSegmentationInParallelTest()
+{
+  typedef int Coordinate;
+  typedef FreemanChain<Coordinate> FC; 
+  typedef PointVector<2,Coordinate> Point; 
+
+  std::string filename = testPath + "samples/BigBall2.fc";
+  std::fstream fst;
+  fst.open (filename.c_str(), std::ios::in);
+  FC fc(fst);
+
+  vector<Point> vPts; 
+  vPts.assign(fc.begin(),fc.end()); 
+
+  typedef vector<Point>::const_iterator ConstIterator; 
+  typedef Circulator<ConstIterator> ConstCirculator; 
+
+  bool res = true;
+
+  trace.beginBlock("divide-and-conquer saturated Segmentation of an open curve");
+  trace.info() << filename << endl;
+  typedef ArithmeticalDSSComputer<ConstIterator,Coordinate,4> RecognitionAlgorithm;
+  typedef SaturatedSegmentation<RecognitionAlgorithm> Segmentation;
+  Segmentation s(vPts.begin(), vPts.end(), RecognitionAlgorithm());
+  const unsigned int nbChunks[] = { 0, 1, 2, 3, 7, 64, 1000, 10000 };
+  for (unsigned int k = 0; k < 8; ++k)
+    res = res && compareInParallel(s, nbChunks[k]);
+  s.setMode("First");
+  res = res && compareInParallel(s, 7);
+  s.setMode("Last++");
+  res = res && compareInParallel(s, 7);
+  trace.endBlock();
+
+  trace.beginBlock("divide-and-conquer saturated Segmentation of a subrange");
+  s.setSubRange(vPts.begin() + 100, vPts.begin() + 1000);
+  res = res && compareInParallel(s, 7);
+  trace.endBlock();
+
+  trace.beginBlock("divide-and-conquer saturated Segmentation of a closed curve");
+  typedef ArithmeticalDSSComputer<ConstCirculator,Coordinate,4> CircularRecognitionAlgorithm;
+  typedef SaturatedSegmentation<CircularRecognitionAlgorithm> CircularSegmentation;
+  ConstCirculator c(vPts.begin(), vPts.begin(), vPts.end() ); 
+  CircularSegmentation cs(c, c, CircularRecognitionAlgorithm());
+  res = res && compareInParallel(cs, 7);
+  trace.endBlock();
+
+  return res;
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -951,6 +1027,7 @@ int main(int argc, char **argv)
   bool res = greedySegmentationVisualTest()
 && SaturatedSegmentationVisualTest()
 && SaturatedSegmentationTest()
+&& SaturatedSegmentationInParallelTest()
 ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,200 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStreamingDSSSegmentation.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class StreamingDSSSegmentation and the
+ * extension of an ArithmeticalDSS by a range of points.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/StreamingDSSSegmentation.h"
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<2, int> Point;
+typedef std::vector<Point> Points;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class StreamingDSSSegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Random walk whose steps are mostly two directions that change
+ * from time to time, so that the points are decomposed into DSSs of
+ * various slopes.
+ * @param adjacency 4 or 8.
+ * @param n the number of points.
+ */
+Points randomWalk( unsigned short adjacency, unsigned int n )
+{
+  const Point steps4[] = { Point( 1, 0 ), Point( 0, 1 ), Point( -1, 0 ), Point( 0, -1 ) };
+  const Point steps8[] = { Point( 1, 0 ), Point( 1, 1 ), Point( 0, 1 ), Point( -1, 1 ),
+                           Point( -1, 0 ), Point( -1, -1 ), Point( 0, -1 ), Point( 1, -1 ) };
+  const unsigned int nbSteps = ( adjacency == 4 ) ? 4 : 8;
+  const Point* steps = ( adjacency == 4 ) ? steps4 : steps8;
+  Points points( 1, Point( 0, 0 ) );
+  unsigned int dir = 0;
+  unsigned int period = 2 + rand() % 20;
+  for ( unsigned int i = 1; i < n; ++i )
+    {
+      if ( rand() % 200 == 0 )
+        {
+          dir = rand() % nbSteps;
+          period = 2 + rand() % 20;
+        }
+      const unsigned int d = ( i % period == 0 || rand() % 50 == 0 ) ? ( dir + 1 ) % nbSteps : dir;
+      points.push_back( points.back() + steps[ d ] );
+    }
+  return points;
+}
+
+/**
+ * Compares the extension of a DSS by a range with the extension point
+ * by point, from every starting point.
+ */
+template <typename DSS>
+bool testExtendFrontRange( const Points & points )
+{
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  for ( Points::const_iterator it = points.begin(); it != points.end(); ++it )
+    {
+      DSS dss( *it );
+      Points::const_iterator itRange = dss.extendFront( it + 1, points.end() );
+      DSS ref( *it );
+      Points::const_iterator itRef = it + 1;
+      while ( ( itRef != points.end() ) && ( ref.extendFront( *itRef ) ) )
+        ++itRef;
+      nbok += ( itRange == itRef && dss == ref && dss.isValid() ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") extensions" << std::endl;
+  return nbok == nb;
+}
+
+/**
+ * Compares the streaming segmentation with GreedySegmentation, for
+ * several chunk sizes.
+ */
+template <unsigned short adjacency>
+bool testStreamingSegmentation( const Points & points )
+{
+  typedef ArithmeticalDSSComputer<Points::const_iterator, int, adjacency> SegmentComputer;
+  typedef GreedySegmentation<SegmentComputer> Segmentation;
+  typedef StreamingDSSSegmentation<int, int, adjacency> Streaming;
+  typedef typename Streaming::DSS DSS;
+
+  std::vector<DSS> reference;
+  Segmentation segmentation( points.begin(), points.end(), SegmentComputer() );
+  for ( typename Segmentation::SegmentComputerIterator it = segmentation.begin(),
+          itEnd = segmentation.end(); it != itEnd; ++it )
+    reference.push_back( it->primitive() );
+
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+  const unsigned int chunkSizes[] = { 1, 2, 7, 16, 100, (unsigned int) points.size() };
+  for ( unsigned int k = 0; k < 6; ++k )
+    {
+      Streaming streaming;
+      std::vector<DSS> segments;
+      for ( std::size_t i = 0; i < points.size(); i += chunkSizes[ k ] )
+        {
+          const std::size_t j = std::min( points.size(), i + chunkSizes[ k ] );
+          streaming.push( points.begin() + i, points.begin() + j, std::back_inserter( segments ) );
+        }
+      const bool nbPointsOk = ( streaming.nbPoints() == points.size() );
+      streaming.flush( std::back_inserter( segments ) );
+      nbok += ( nbPointsOk && streaming.isEmpty() && segments == reference ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << reference.size() << " segments" << std::endl;
+  return nbok == nb;
+}
+
+/**
+ * Tests on contours and random walks.
+ */
+bool testStreamingDSSSegmentation()
+{
+  trace.beginBlock( "Streaming segmentation of 4-connected points" );
+  bool res = true;
+  const std::string files[] = { "samples/contourS.fc", "samples/france.fc", "samples/klokan.fc" };
+  for ( unsigned int i = 0; i < 3; ++i )
+    {
+      std::ifstream instream( ( testPath + files[ i ] ).c_str() );
+      FreemanChain<int> fc( instream );
+      Points points;
+      FreemanChain<int>::getContourPoints( fc, points );
+      res = res && testExtendFrontRange< ArithmeticalDSS<int, int, 4> >( points )
+        && testStreamingSegmentation<4>( points );
+    }
+  const Points walk4 = randomWalk( 4, 5000 );
+  res = res && testExtendFrontRange< ArithmeticalDSS<int, DGtal::int64_t, 4> >( walk4 )
+    && testStreamingSegmentation<4>( walk4 );
+  trace.endBlock();
+
+  trace.beginBlock( "Streaming segmentation of 8-connected points" );
+  const Points walk8 = randomWalk( 8, 5000 );
+  res = res && testExtendFrontRange< ArithmeticalDSS<int, int, 8> >( walk8 )
+    && testStreamingSegmentation<8>( walk8 );
+  // disconnected points
+  Points holes( walk8 );
+  for ( std::size_t i = 100; i < holes.size(); i += 100 )
+    holes[ i ] += Point( 5, 0 );
+  res = res && testStreamingSegmentation<8>( holes );
+  trace.endBlock();
+
+  return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class StreamingDSSSegmentation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testStreamingDSSSegmentation(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <string>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/Statistic.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -142,13 +144,36 @@ checkPlanes( unsigned int nbplanes, int diameter, unsigned int nbpoints,
 }
 
 
+/**
+ * Runs checkPlanes and outputs one line of results.
+ */
+template <typename NaivePlaneComputer>
+bool
+benchmarkPlanes( const std::string & name, unsigned int nbtries, int diameter, unsigned int nbpoints )
+{
+  Statistic<double> stats;
+  srand( 0 );
+  trace.beginBlock ( "Testing class COBANaivePlaneComputer with " + name );
+  bool res = checkPlanes<NaivePlaneComputer>( nbtries, diameter, nbpoints, stats );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  long t = trace.endBlock();
+  stats.terminate();
+  std::cout << name << " " << stats.samples()
+            << " " << nbpoints
+            << " " << diameter 
+            << " " << ( (double) t / (double) stats.samples() )
+            << " " << stats.mean()
+            << " " << stats.variance()
+            << std::endl;
+  return res;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
 int main( int argc, char** argv )
 {
   using namespace Z3i;
-  Statistic<double> stats;
   unsigned int nbtries = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 100;
   unsigned int nbpoints = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 100;
   unsigned int diameter = ( argc > 3 ) ? atoi( argv[ 3 ] ) : 100;
@@ -157,19 +182,16 @@ int main( int argc, char** argv )
   std::cout << "# Integer nbtries nbpoints diameter time/plane(ms) E(comp) V(comp)" << std::endl;
   
  // Max diameter is ~20 for int32_t, ~500 for int64_t, any with BigInteger.
-  trace.beginBlock ( "Testing class COBANaivePlaneComputer" );
   bool res = true 
-    && checkPlanes<COBANaivePlaneComputer<Z3, DGtal::BigInteger> >( nbtries, diameter, nbpoints, stats );
-  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
-  long t = trace.endBlock();
-  stats.terminate();
-  std::cout << "BigInteger" << " " << stats.samples()
-            << " " << nbpoints
-            << " " << diameter 
-            << " " << ( (double) t / (double) stats.samples() )
-            << " " << stats.mean()
-            << " " << stats.variance()
-            << std::endl;
+    && benchmarkPlanes<COBANaivePlaneComputer<Z3, DGtal::BigInteger> >
+    ( "BigInteger", nbtries, diameter, nbpoints );
+  // Points stored in a std::set or appended to a std::vector.
+  if ( diameter <= 500 )
+    res = res
+      && benchmarkPlanes<COBANaivePlaneComputer<Z3, DGtal::int64_t> >
+      ( "int64_t/set", nbtries, diameter, nbpoints )
+      && benchmarkPlanes<COBANaivePlaneComputer<Z3, DGtal::int64_t, std::vector<Point> > >
+      ( "int64_t/vector", nbtries, diameter, nbpoints );
   return res ? 0 : 1;
 }
 //                                                                           //
@@ -30,12 +30,14 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/geometry/surfaces/CAdditivePrimitiveComputer.h"
 #include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
 #include "DGtal/geometry/surfaces/COBAGenericNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/COBAPromotingNaivePlaneComputer.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -387,6 +389,37 @@ checkManyPlanes( unsigned int diameter,
   return nbok == nb;
 }
 
+/**
+ * Checks that COBAPromotingNaivePlaneComputer chooses the expected
+ * internal integer for \a diameter and recognizes planes.
+ */
+bool
+checkPromotingPlanes( int diameter,
+                      COBAPromotingNaivePlaneComputer<Z3i::Space>::IntegerLevel level,
+                      unsigned int nbplanes,
+                      unsigned int nbpoints )
+{
+  typedef COBAPromotingNaivePlaneComputer<Z3i::Space> NaivePlaneComputer;
+  BOOST_CONCEPT_ASSERT(( CAdditivePrimitiveComputer< NaivePlaneComputer > ));
+  BOOST_CONCEPT_ASSERT(( boost::ForwardContainer< NaivePlaneComputer > ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  stringstream ss (stringstream::out);
+  ss << "Testing block: COBAPromotingNaivePlaneComputer with diameter " << diameter << ".";
+  trace.beginBlock ( ss.str() );
+  NaivePlaneComputer plane;
+  plane.init( 2, diameter, 1, 1 );
+  ++nb, nbok += plane.level() == level ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb 
+               << ") level() == " << level << std::endl;
+  ++nb, nbok += checkPlanes<DGtal::int64_t,NaivePlaneComputer>( nbplanes, diameter, nbpoints ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb 
+               << ") checkPlanes<int64_t,NaivePlaneComputer>()"
+               << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 /**
    NB (JOL): Unreliable.
 */
@@ -485,13 +518,21 @@ int main( int /*argc*/, char** /*argv*/ )
 {
   using namespace Z3i;
 
-  // Max diameter is ~20 for int32_t, ~500 for int64_t, any with BigInteger.
+  // Max diameter is ~20 for int32_t, ~500 for int64_t, ~500000 for
+  // int128_t, any with BigInteger.
   trace.beginBlock ( "Testing class COBANaivePlaneComputer" );
   bool res = true 
     && testCOBANaivePlaneComputer()
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int32_t> >( 20, 100, 200 )
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int64_t> >( 500, 100, 200 )
+    && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int64_t, std::vector<Z3::Point> > >( 500, 100, 200 )
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::BigInteger> >( 10000, 10, 200 )
+#ifdef WITH_INT128
+    && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int128_t> >( 100000, 10, 200 )
+    && checkPromotingPlanes( 100000, COBAPromotingNaivePlaneComputer<Z3>::Int128Level, 10, 200 )
+    && checkPromotingPlanes( 1000000, COBAPromotingNaivePlaneComputer<Z3>::BigIntegerLevel, 5, 200 )
+#endif
+    && checkPromotingPlanes( 500, COBAPromotingNaivePlaneComputer<Z3>::Int64Level, 100, 200 )
     && checkExtendWithManyPoints<COBAGenericNaivePlaneComputer<Z3, DGtal::int64_t> >( 100, 100, 200 );
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -30,6 +30,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <string>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/Statistic.h"
 #include "DGtal/helpers/StdDefs.h"
@@ -133,6 +135,26 @@ checkPlanes( unsigned int nbplanes, unsigned int diameter, unsigned int nbpoints
 }
 
 
+/**
+ * Runs checkPlanes and outputs one line of results.
+ */
+template <typename NaivePlaneComputer>
+bool
+benchmarkPlanes( const std::string & name, unsigned int nbtries, unsigned int diameter, unsigned int nbpoints )
+{
+  srand( 0 );
+  trace.beginBlock ( "Testing class ChordNaivePlaneComputer with " + name );
+  bool res = checkPlanes<NaivePlaneComputer>( nbtries, diameter, nbpoints );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  long t = trace.endBlock();
+  std::cout << name << " " << nbtries
+            << " " << nbpoints
+            << " " << diameter 
+            << " " << ( (double) t / (double) nbtries )
+            << std::endl;
+  return res;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -146,16 +168,12 @@ int main( int argc, char** argv )
   std::cout << "# Test class ChordNaivePlaneComputer. Points are randomly chosen in [-diameter,diameter]^3." << std::endl;
   std::cout << "# Integer nbtries nbpoints diameter time/plane(ms)" << std::endl;
   
-  trace.beginBlock ( "Testing class ChordNaivePlaneComputer" );
+  // Points stored in a std::set or appended to a std::vector.
   bool res = true 
-    && checkPlanes<ChordNaivePlaneComputer<Space, Point, DGtal::int64_t> >( nbtries, diameter, nbpoints );
-  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
-  long t = trace.endBlock();
-  std::cout << "int64_t" << " " << nbtries
-            << " " << nbpoints
-            << " " << diameter 
-            << " " << ( (double) t / (double) nbtries )
-            << std::endl;
+    && benchmarkPlanes<ChordNaivePlaneComputer<Space, Point, DGtal::int64_t> >
+    ( "int64_t/set", nbtries, diameter, nbpoints )
+    && benchmarkPlanes<ChordNaivePlaneComputer<Space, Point, DGtal::int64_t, std::vector<Point> > >
+    ( "int64_t/vector", nbtries, diameter, nbpoints );
   return res ? 0 : 1;
 }
 //                                                                           //
@@ -0,0 +1,235 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSurfacePlaneSegmentation.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DigitalSurfacePlaneSegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <map>
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/ChordNaivePlaneComputer.h"
+#include "DGtal/geometry/surfaces/DigitalSurfacePlaneSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef DigitalSetBoundary<KSpace,DigitalSet> MyDigitalSurfaceContainer;
+typedef DigitalSurface<MyDigitalSurfaceContainer> MyDigitalSurface;
+typedef MyDigitalSurface::Vertex Vertex;
+typedef BreadthFirstVisitor<MyDigitalSurface> Visitor;
+
+/// Initializes a COBANaivePlaneComputer as in greedy-plane-segmentation.cpp.
+struct COBAInitializer
+{
+  template <typename PlaneComputer>
+  void operator()( PlaneComputer & plane, Dimension axis ) const
+  {
+    plane.init( axis, 500, 1, 1 );
+  }
+};
+
+/// Initializes a ChordNaivePlaneComputer of width 3/2.
+struct ChordInitializer
+{
+  template <typename PlaneComputer>
+  void operator()( PlaneComputer & plane, Dimension axis ) const
+  {
+    plane.init( axis, 3, 2 );
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSurfacePlaneSegmentation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Greedy segmentation of greedy-plane-segmentation.cpp, with the
+ * seeds in the given order.
+ * @return the label of each surfel.
+ */
+template <typename Segmentation, typename PlaneInitializer>
+std::vector<typename Segmentation::Index>
+referenceLabels( const MyDigitalSurface & digSurf, const Segmentation & segmentation,
+                 const PlaneInitializer & anInitializer )
+{
+  typedef typename Segmentation::Index Index;
+  typedef typename Segmentation::PlaneComputer PlaneComputer;
+  const KSpace & ks = digSurf.container().space();
+  std::map<Vertex, Index> v2plane;
+  Index nbPlanes = 0;
+  for ( Index i = 0; i < segmentation.size(); ++i )
+    {
+      Vertex v = segmentation.surfel( segmentation.seedOrder()[ i ] );
+      if ( v2plane.find( v ) != v2plane.end() )
+        continue;
+      PlaneComputer plane;
+      anInitializer( plane, ks.sOrthDir( v ) );
+      Visitor visitor( digSurf, v );
+      bool isEmpty = true;
+      while ( ! visitor.finished() )
+        {
+          v = visitor.current().first;
+          if ( v2plane.find( v ) == v2plane.end() )
+            {
+              Dimension axis = ks.sOrthDir( v );
+              if ( plane.extend( ks.sCoords( ks.sDirectIncident( v, axis ) ) ) )
+                {
+                  v2plane[ v ] = nbPlanes;
+                  isEmpty = false;
+                  visitor.expand();
+                }
+              else
+                visitor.ignore();
+            }
+          else
+            visitor.ignore();
+        }
+      if ( ! isEmpty ) ++nbPlanes;
+    }
+  std::vector<Index> labels( segmentation.size(), Segmentation::InvalidIndex );
+  for ( Index i = 0; i < segmentation.size(); ++i )
+    labels[ i ] = v2plane[ segmentation.surfel( i ) ];
+  return labels;
+}
+
+/**
+ * Checks that the pieces are a partition of the surfels and that each
+ * plane contains the points of its piece.
+ */
+template <typename Segmentation>
+bool checkPieces( const Segmentation & segmentation )
+{
+  typedef typename Segmentation::Index Index;
+  typedef typename Segmentation::ConstIterator ConstIterator;
+  bool ok = segmentation.isValid();
+  std::size_t nbSurfels = 0;
+  for ( Index k = 0; k < segmentation.nbPlanes(); ++k )
+    for ( ConstIterator it = segmentation.begin( k ), itE = segmentation.end( k ); it != itE; ++it )
+      {
+        ok = ok && ( segmentation.label( *it ) == k )
+          && segmentation.plane( k )( segmentation.point( *it ) );
+        ++nbSurfels;
+      }
+  for ( Index i = 0; i < segmentation.size(); ++i )
+    ok = ok && ( segmentation.index( segmentation.surfel( i ) ) == i );
+  return ok && ( nbSurfels == segmentation.size() );
+}
+
+template <typename PlaneComputer, typename PlaneInitializer>
+bool testSegmentation( const MyDigitalSurface & digSurf, const PlaneInitializer & anInitializer )
+{
+  typedef DigitalSurfacePlaneSegmentation<MyDigitalSurface, PlaneComputer> Segmentation;
+  typedef typename Segmentation::Index Index;
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+
+  Segmentation segmentation( digSurf );
+  nbok += ( segmentation.size() == digSurf.size() ) ? 1 : 0;
+  nb++;
+  const unsigned int nbSeeds[] = { 1, 8, 0 };
+
+  // seeds in the order of the surface, as in greedy-plane-segmentation.cpp
+  std::vector<Index> reference = referenceLabels( digSurf, segmentation, anInitializer );
+  for ( unsigned int k = 0; k < 3; ++k )
+    {
+      segmentation.compute( anInitializer, nbSeeds[ k ] );
+      nbok += ( checkPieces( segmentation ) && segmentation.labels() == reference ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << segmentation << std::endl;
+
+  // shuffled seeds
+  std::vector<Index> seeds( segmentation.seedOrder() );
+  std::mt19937 gen( 42 );
+  std::shuffle( seeds.begin(), seeds.end(), gen );
+  segmentation.setSeedOrder( seeds );
+  reference = referenceLabels( digSurf, segmentation, anInitializer );
+  for ( unsigned int k = 0; k < 3; ++k )
+    {
+      segmentation.compute( anInitializer, nbSeeds[ k ] );
+      nbok += ( checkPieces( segmentation ) && segmentation.labels() == reference ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") shuffled seeds " << segmentation << std::endl;
+  return nbok == nb;
+}
+
+bool testDigitalSurfacePlaneSegmentation()
+{
+  trace.beginBlock( "Creating digital surface" );
+  Domain domain( Point::diagonal( -16 ), Point::diagonal( 16 ) );
+  DigitalSet set3d( domain );
+  Shapes<Domain>::addNorm2Ball( set3d, Point( 0, 0, 0 ), 12 );
+  Shapes<Domain>::addNorm1Ball( set3d, Point( 6, 3, -2 ), 9 );
+  Shapes<Domain>::removeNorm2Ball( set3d, Point( 0, 0, 0 ), 5 );
+  KSpace ks;
+  ks.init( domain.lowerBound(), domain.upperBound(), true );
+  SurfelAdjacency<KSpace::dimension> surfAdj( true );
+  MyDigitalSurface digSurf( new MyDigitalSurfaceContainer( ks, set3d, surfAdj ) );
+  trace.info() << "surfels=" << digSurf.size() << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock( "Segmentation with COBANaivePlaneComputer" );
+  bool res = testSegmentation< COBANaivePlaneComputer<Z3, DGtal::int64_t> >( digSurf, COBAInitializer() );
+  trace.endBlock();
+
+  trace.beginBlock( "Segmentation with ChordNaivePlaneComputer" );
+  res = res && testSegmentation< ChordNaivePlaneComputer<Z3, Point, DGtal::int64_t> >( digSurf, ChordInitializer() );
+  trace.endBlock();
+  return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSurfacePlaneSegmentation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testDigitalSurfacePlaneSegmentation(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
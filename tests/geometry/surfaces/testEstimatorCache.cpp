@@ -33,9 +33,13 @@
 #include "ConfigTest.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/surfaces/estimation/EstimatorCache.h"
+#include "DGtal/geometry/surfaces/estimation/IndexedEstimatorCache.h"
 ///
 /// Shape
 #include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/shapes/ShapeGeometricFunctors.h"
+#include "DGtal/io/readers/MPolynomialReader.h"
 
  /// Digitization
 #include "DGtal/shapes/GaussDigitizer.h"
@@ -47,6 +51,7 @@
 /// Estimator
 #include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
 #include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/TrueDigitalSurfaceLocalEstimator.h"
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -184,7 +189,101 @@ bool testEstimatorCache(double h)
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "
 	       << "cache == eval" << std::endl;
-  
+
+  trace.beginBlock( "Indexed cache ...");
+  typedef IndexedEstimatorCache<MyIICurvatureEstimator> IndexedGaussianCache;
+  BOOST_CONCEPT_ASSERT(( concepts::CSurfelLocalEstimator<IndexedGaussianCache> ));
+  IndexedGaussianCache icache( curvatureEstimator );
+  icache.init( h, surf.begin(), surf.end() );
+  trace.info() << icache << std::endl;
+  bool iok = icache.size() == cache.size();
+  for(MyDigitalSurface::ConstIterator it = surf.begin(), itend=surf.end(); it != itend; ++it)
+    {
+      IndexedGaussianCache::Index i = icache.index( *it );
+      if ( icache.eval(it) != cache.eval(it)
+           || icache.evalAt( i ) != cache.eval(it)
+           || icache.surfel( i ) != *it )
+        {
+          iok=false;
+          trace.error() << "Incorrect indexed value at "<<*it<<std::endl;
+        }
+    }
+  trace.endBlock();
+  nbok += iok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "indexed cache == cache" << std::endl;
+
+
+  return nbok == nb;
+}
+
+/**
+ * Checks that the parallel fill of IndexedEstimatorCache gives the
+ * same values as the sequential one. The estimator must be
+ * thread-safe, hence the true mean curvature of a polynomial sphere.
+ */
+bool testParallelIndexedEstimatorCache()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef MPolynomial< 3, double > Polynomial3;
+  typedef MPolynomialReader< 3, double > Polynomial3Reader;
+  typedef ImplicitPolynomial3Shape<Z3i::Space> ImplicitShape;
+  typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+  typedef LightImplicitDigitalSurface<Z3i::KSpace,DigitalShape> Boundary;
+  typedef DigitalSurface< Boundary > MyDigitalSurface;
+  typedef functors::ShapeGeometricFunctors::ShapeMeanCurvatureFunctor<ImplicitShape> MeanCurvatureFunctor;
+  typedef TrueDigitalSurfaceLocalEstimator<Z3i::KSpace, ImplicitShape, MeanCurvatureFunctor> TrueMeanCurvatureEstimator;
+  typedef IndexedEstimatorCache<TrueMeanCurvatureEstimator> IndexedMeanCurvatureCache;
+
+  trace.beginBlock( "Shape initialisation ..." );
+  std::string poly_str = "-81.0+x^2+y^2+z^2";
+  Polynomial3 poly;
+  Polynomial3Reader reader;
+  reader.read( poly, poly_str.begin(), poly_str.end() );
+  ImplicitShape ishape( poly );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -10.0, -10.0, -10.0 ), Z3i::RealPoint( 10.0, 10.0, 10.0 ), 1.0 );
+
+  Z3i::KSpace K;
+  if ( !K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) )
+  {
+    trace.error() << "Problem with Khalimsky space" << std::endl;
+    return false;
+  }
+  Z3i::KSpace::Surfel bel = Surfaces<Z3i::KSpace>::findABel( K, dshape, 10000 );
+  Boundary boundary( K, dshape, SurfelAdjacency<Z3i::KSpace::dimension>( true ), bel );
+  MyDigitalSurface surf ( boundary );
+  trace.endBlock();
+
+  trace.beginBlock( "Indexed cache, sequential and parallel fill ...");
+  TrueMeanCurvatureEstimator estimator;
+  estimator.setParams( K, MeanCurvatureFunctor() );
+  estimator.attach( ishape );
+  IndexedMeanCurvatureCache scache( estimator );
+  scache.init( 1.0, surf.begin(), surf.end() );
+  IndexedMeanCurvatureCache pcache( estimator, true );
+  pcache.init( 1.0, surf.begin(), surf.end() );
+  trace.info() << pcache << std::endl;
+  bool ok = pcache.size() == scache.size() && pcache.size() == surf.size();
+  for(IndexedMeanCurvatureCache::Index i = 0; ok && i < pcache.size(); ++i)
+    {
+      if ( pcache.surfel( i ) != scache.surfel( i )
+           || pcache.evalAt( i ) != scache.evalAt( i ) )
+        {
+          ok=false;
+          trace.error() << "Incorrect parallel value at "<<scache.surfel( i )<<std::endl;
+        }
+    }
+  trace.endBlock();
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "parallel fill == sequential fill" << std::endl;
+
   return nbok == nb;
 }
 
@@ -199,7 +298,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testEstimatorCache( 0.8 ); // && ... other tests
+  bool res = testEstimatorCache( 0.8 )
+    && testParallelIndexedEstimatorCache(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -29,6 +29,8 @@
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
+#include <vector>
+#include <iterator>
 
 #include "DGtal/base/Common.h"
 
@@ -496,6 +498,128 @@ bool incTest(OrientationFunctor f, const DGtal::int32_t n = 1000000)
   return true; 
 }
 
+/**
+ * Function that traces to the standard output the running
+ * time of a given orientation functor @a f for @a n computations
+ * with the same two first points, point by point and then with 
+ * the batch operator. 
+ * The last points are randomly chosen by @a gen with probability
+ * 1/3, otherwise they are collinear or quasi-collinear with the two
+ * first points. 
+ * @param f a functor to run
+ * @param gen a generator providing random numbers
+ * @param n number of tries 
+ * @return 'true' if both ways give the same results. 
+ * @tparam OrientationFunctor a model of COrientationFunctor2
+ * with a batch operator
+ */
+template<typename OrientationFunctor, typename RandomFunctor>
+bool batchTest(OrientationFunctor f, RandomFunctor gen, const DGtal::int32_t n = 1000000)
+{
+  BOOST_CONCEPT_ASSERT((  DGtal::concepts::COrientationFunctor2<OrientationFunctor> )); 
+
+  typedef typename OrientationFunctor::Point Point; 
+  typedef typename OrientationFunctor::Value Value; 
+  typedef typename Point::Coordinate Coordinate; 
+  Point P, Q, U; 
+
+  P[0] = gen(); 
+  P[1] = gen(); 
+  U[0] = signedRandomInt15(); 
+  U[1] = signedRandomInt15(); 
+  Q = P + U; 
+  std::vector<Point> points; 
+  points.reserve( n ); 
+  for (DGtal::int32_t i = 0; (i < n); ++i)
+    {
+      const int r = rand()%3; 
+      if (r == 0)
+        points.push_back( Point( gen(), gen() ) ); 
+      else
+        points.push_back( P + U*static_cast<Coordinate>( rand()%2048 - 1024 ) 
+                          + Point( r-1, 0 ) ); 
+    }
+  std::vector<Value> values, batchValues; 
+  values.reserve( n ); 
+  batchValues.reserve( n ); 
+  f.init(P, Q);
+
+  clock_t timeBegin, timeEnd;
+  long double time, CPUTime;
+  timeBegin = clock();
+  for (typename std::vector<Point>::const_iterator it = points.begin(); it != points.end(); ++it)
+    values.push_back( f( *it ) ); 
+  timeEnd = clock();
+  time = ((double)timeEnd-(double)timeBegin); 
+  CPUTime = time/((double)CLOCKS_PER_SEC);  
+  std::cout << CPUTime << " "; 
+
+  timeBegin = clock();
+  f( points.begin(), points.end(), std::back_inserter( batchValues ) ); 
+  timeEnd = clock();
+  time = ((double)timeEnd-(double)timeBegin); 
+  CPUTime = time/((double)CLOCKS_PER_SEC);  
+  std::cout << CPUTime << " "; 
+
+  return values == batchValues; 
+}
+
+/**
+ * Function that traces to the standard output the running
+ * time of the functors based on a 2x2 determinant computer, 
+ * point by point and with the batch operator. 
+ * @return 'true' if both ways give the same results. 
+ */
+bool batchTestComparison()
+{
+  bool res = true; 
+  long seed = time(NULL); 
+
+  std::cout << "# batch input: many points tested against the same two points " << std::endl; 
+  std::cout << "# running times in s. for 1 million tries" << std::endl; 
+  std::cout << "# columns: point by point, batch " << std::endl; 
+
+  { 
+    srand(seed); 
+    std::cout << "2x2-int32-int64 "; 
+    typedef PointVector<2, DGtal::int32_t> Point; 
+    typedef Simple2x2DetComputer<DGtal::int32_t, DGtal::int64_t> DetComputer; 
+    typedef InHalfPlaneBy2x2DetComputer<Point, DetComputer> F; 
+    res = res && batchTest( F(), signedRandomInt30 );
+    std::cout << std::endl; 
+  }
+  { 
+    srand(seed); 
+    std::cout << "2x2-avnaim-int32-double "; 
+    typedef PointVector<2, DGtal::int32_t> Point; 
+    typedef AvnaimEtAl2x2DetSignComputer<double> DetComputer; 
+    typedef InHalfPlaneBy2x2DetComputer<Point, DetComputer> F; 
+    res = res && batchTest( F(), signedRandomInt30 );
+    std::cout << std::endl;   
+  }
+  {
+    srand(seed); 
+    std::cout << "2x2-avnaim++-int32-double "; 
+    typedef PointVector<2, DGtal::int32_t> Point; 
+    typedef AvnaimEtAl2x2DetSignComputer<double> DetComputer; 
+    typedef Filtered2x2DetComputer<DetComputer> FDetComputer; 
+    typedef InHalfPlaneBy2x2DetComputer<Point, FDetComputer> F; 
+    res = res && batchTest( F(), signedRandomInt30 );
+    std::cout << std::endl;   
+  }
+  {
+    srand(seed); 
+    std::cout << "2x2-avnaim++-int64-double ";
+    typedef PointVector<2, DGtal::int64_t> Point;  
+    typedef AvnaimEtAl2x2DetSignComputer<double> DetComputer; 
+    typedef Filtered2x2DetComputer<DetComputer> FDetComputer; 
+    typedef InHalfPlaneBy2x2DetComputer<Point, FDetComputer> F; 
+    res = res && batchTest( F(), signedRandomInt30 );
+    std::cout << std::endl;   
+  }
+  return res; 
+}
+
 /**
  * Function that traces to the standard output the running
  * time of all available functors for random points whose 
@@ -928,7 +1052,7 @@ int main( int argc, char** argv )
   randomTest52All(); 
   randomTest62All(); 
 
-  bool res = true; 
+  bool res = batchTestComparison(); 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
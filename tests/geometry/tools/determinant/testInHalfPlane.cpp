@@ -29,11 +29,15 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <iterator>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 
 #include "DGtal/geometry/tools/determinant/Simple2x2DetComputer.h"
 #include "DGtal/geometry/tools/determinant/AvnaimEtAl2x2DetSignComputer.h"
+#include "DGtal/geometry/tools/determinant/Filtered2x2DetComputer.h"
 
 #include "DGtal/geometry/tools/determinant/COrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBy2x2DetComputer.h"
@@ -91,6 +95,88 @@ bool testInHalfPlane(OrientationFunctor f)
   return nbok == nb;
 }
 
+/**
+ * Compares the batch operator with the single point operator, 
+ * for random, collinear and quasi-collinear points. 
+ * @param f any orientation functor
+ * @param range the coordinates lie in [-range ; range[
+ * @tparam OrientationFunctor a model of COrientationFunctor2
+ * with a batch operator
+ */
+template<typename OrientationFunctor>
+bool testBatchInHalfPlane(OrientationFunctor f, DGtal::int64_t range)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing batch operator..." );
+  trace.info() << f << endl; 
+
+  typedef typename OrientationFunctor::Value Value; 
+  typedef typename OrientationFunctor::Point Point; 
+  typedef typename Point::Coordinate Coordinate; 
+  for (int i = 0; i < 50; i++)
+    {
+      const Point a( rand()%range - range/2, rand()%range - range/2 );
+      const Point u( rand()%32 - 16, rand()%32 - 16 ); 
+      const Point b = a + u*(Coordinate)(1 + rand()%16); 
+      std::vector<Point> points; 
+      for (int j = 0; j < 1000 + i; j++)
+	{
+	  if (j%3 == 0) //random point
+	    points.push_back( Point( rand()%range - range/2, rand()%range - range/2 ) ); 
+	  else //collinear or quasi-collinear point
+	    points.push_back( a + u*(Coordinate)(rand()%64 - 32) + Point( j%3 - 1, 0 ) ); 
+	}
+      f.init(a, b); 
+      std::vector<Value> values, batchValues; 
+      for (typename std::vector<Point>::const_iterator it = points.begin(); it != points.end(); ++it)
+	values.push_back( f( *it ) ); 
+      f( points.begin(), points.end(), std::back_inserter( batchValues ) ); 
+      if ( values == batchValues )
+	nbok++; 
+      nb++; 
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
+/**
+ * Checks a null determinant filtered with products whose exact value
+ * is 2^53+1, but whose rounded value is 2^53, with both the single
+ * and the batch operators. 
+ * @tparam DetComputer a filtered 2x2 determinant computer
+ */
+template<typename DetComputer>
+bool testFilteredRoundedProducts()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing filtered products rounded to 2^53..." );
+  typedef typename DetComputer::ArgumentInteger ArgumentInteger; 
+  typedef typename DetComputer::ResultInteger ResultInteger; 
+  DetComputer det; 
+  det.init( 3.0, 2.0 ); 
+  //3*3002399751580331 - 2*2^52 = 1
+  const ArgumentInteger x[2] = { 4503599627370496.0, 4503599627370496.0 }; 
+  const ArgumentInteger y[2] = { 3002399751580331.0, 3002399751580331.0 }; 
+  if ( det( x[0], y[0] ) > 0 )
+    nbok++; 
+  nb++; 
+  ResultInteger results[2]; 
+  det( x, y, 2, results ); 
+  if ( (results[0] > 0) && (results[1] > 0) )
+    nbok++; 
+  nb++; 
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 /**
  * Example of a test. To be completed.
  */
@@ -285,6 +371,17 @@ int main( int argc, char** argv )
   typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int32_t> Functor2; 
   res = res && testInHalfPlane( Functor2() );
 
+  res = res && testBatchInHalfPlane( Functor1(), 4096 );
+
+  typedef PointVector<2, DGtal::int64_t> Point64; 
+  typedef AvnaimEtAl2x2DetSignComputer<double> DetComputer3; 
+  typedef Filtered2x2DetComputer<DetComputer3> FDetComputer3; 
+  typedef InHalfPlaneBy2x2DetComputer<Point64, FDetComputer3> Functor3; 
+  res = res && testInHalfPlane( Functor3() );
+  res = res && testBatchInHalfPlane( Functor3(), 4096 );
+  res = res && testBatchInHalfPlane( Functor3(), 1073741824 );
+  res = res && testFilteredRoundedProducts<FDetComputer3>();
+
   res = res && testInGeneralizedDiskOfGivenRadius(); 
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
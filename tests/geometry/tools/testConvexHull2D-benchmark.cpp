@@ -0,0 +1,107 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConvexHull2D-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the convex hull computation of large sets of random
+ * points, in a square and in a disk:
+ * - andrewConvexHullAlgorithm,
+ * - parallelAndrewConvexHullAlgorithm.
+ *
+ * Usage: testConvexHull2D-benchmark [nbPoints] [nbChunks]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/tools/Hull2DHelpers.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace functions::Hull2D;
+
+typedef PointVector<2, DGtal::int32_t> Point;
+typedef std::vector<Point> Points;
+typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;
+typedef PredicateFromOrientationFunctor2<Functor> Predicate;
+
+/**
+ * Compares both algorithms on the given points.
+ * @return 'true' if both hulls are equal.
+ */
+bool compare( const std::string & name, const Points & points, unsigned int nbChunks )
+{
+  Functor functor;
+  Predicate predicate( functor );
+  Clock clock;
+  double time;
+
+  Points res1, res2;
+  clock.startClock();
+  andrewConvexHullAlgorithm( points.begin(), points.end(), back_inserter( res1 ), predicate );
+  time = clock.stopClock();
+  trace.info() << name << " andrewConvexHullAlgorithm: vertices=" << res1.size()
+               << " time=" << time << " ms" << endl;
+
+  clock.startClock();
+  parallelAndrewConvexHullAlgorithm( points.begin(), points.end(), back_inserter( res2 ), functor, nbChunks );
+  time = clock.stopClock();
+  trace.info() << name << " parallelAndrewConvexHullAlgorithm: vertices=" << res2.size()
+               << " time=" << time << " ms" << endl;
+
+  return res1 == res2;
+}
+
+int main( int argc, char** argv )
+{
+  const unsigned int nbPoints = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 10000000;
+  const unsigned int nbChunks = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 0;
+  const int range = 1 << 20;
+  trace.info() << "points=" << nbPoints << " chunks=" << nbChunks << endl;
+
+  Points square, disk;
+  square.reserve( nbPoints );
+  disk.reserve( nbPoints );
+  while ( square.size() < nbPoints )
+    square.push_back( Point( rand() % range, rand() % range ) );
+  while ( disk.size() < nbPoints )
+    {
+      const Point p( rand() % range - range / 2, rand() % range - range / 2 );
+      if ( 4 * ( (DGtal::int64_t) p[ 0 ] * p[ 0 ] + (DGtal::int64_t) p[ 1 ] * p[ 1 ] )
+           <= (DGtal::int64_t) range * range )
+        disk.push_back( p );
+    }
+
+  const bool res = compare( "square", square, nbChunks ) && compare( "disk", disk, nbChunks );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
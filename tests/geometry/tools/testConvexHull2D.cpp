@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Circulator.h"
 
@@ -330,6 +331,106 @@ bool testConvexHullCompThickness()
   return nb==nbok;
 }
 
+/**
+ * Testing the cancellation of the last addition to an online convex
+ * hull: the hull built with some cancelled additions must be the
+ * same as the hull built from the accepted points only.
+ * @return 'true' if passed. 
+ */
+bool testConvexHullCancelLastAdd()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef PointVector<2,DGtal::int32_t> Point;
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;  
+  typedef DGtal::MelkmanConvexHull<Point, Functor> ConvexHull;
+  
+  trace.beginBlock ( "Cancellation of the last addition..." );
+  const Point steps[] = { Point(1,0), Point(1,1), Point(0,1), Point(-1,1) }; 
+  for (int i = 0; i < 20; i++)
+    {
+      ConvexHull ch, ref; 
+      Point p(0,0);
+      unsigned int nbCancelled = 0; 
+      for (int j = 0; j < 2000; j++)
+        {
+          p += steps[ (j/(1+i) + rand()%2) % 4 ];
+          const ConvexHull copy = ch; 
+          ch.add(p);
+          if (rand()%3 == 0)
+            {
+              ch.cancelLastAdd();
+              nbCancelled++; 
+              if ( (ch.size() == copy.size()) && std::equal(ch.begin(), ch.end(), copy.begin()) )
+                nbok++;
+              nb++; 
+            }
+          else
+            ref.add(p);
+        }
+      if ( (ch.size() == ref.size()) && std::equal(ch.begin(), ch.end(), ref.begin()) && ch.isValid() )
+        nbok++;
+      nb++; 
+      trace.info() << "(" << nbok << "/" << nb << ") " << ch.size() << " vertices, "
+                   << nbCancelled << " cancelled additions" << endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Testing the parallel version of the monotone-chain algorithm: it
+ * must return the same points as the sequential one, whatever the
+ * number of chunks.
+ * @return 'true' if passed. 
+ */
+bool testParallelAndrewConvexHull()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef PointVector<2,DGtal::int32_t> Point;
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;  
+  typedef PredicateFromOrientationFunctor2<Functor> Predicate; 
+  Functor functor; 
+  Predicate predicate( functor ); 
+  using namespace functions::Hull2D; 
+  
+  trace.beginBlock ( "Parallel monotone-chain algorithm..." );
+  const unsigned int nbChunks[] = { 0, 1, 2, 3, 5, 8 };
+  const int ranges[] = { 4, 16, 256, 100000 };
+  for (int i = 0; i < 40; i++)
+    {
+      vector<Point> randomData, res1, res2; 
+      const int range = ranges[ i%4 ]; 
+      const int numberOfPoints = 1 + rand()%5000; 
+      for (int j = 0; j < numberOfPoints; j++)
+        {
+          if (i%8 < 4)
+            randomData.push_back( Point(rand()%range, rand()%range) ); 
+          else
+            { //points in a disk
+              Point p( rand()%range - range/2, rand()%range - range/2 );
+              if ( 4*((DGtal::int64_t)p[0]*p[0] + (DGtal::int64_t)p[1]*p[1]) <= (DGtal::int64_t)range*range )
+                randomData.push_back( p );
+            }
+        }
+      andrewConvexHullAlgorithm( randomData.begin(), randomData.end(), back_inserter( res1 ), predicate );   
+      for (int k = 0; k < 6; k++)
+        {
+          res2.clear(); 
+          parallelAndrewConvexHullAlgorithm( randomData.begin(), randomData.end(), back_inserter( res2 ),
+                                             functor, nbChunks[k] );   
+          if ( res1 == res2 )
+            nbok++; 
+          nb++; 
+        }
+      trace.info() << "(" << nbok << "/" << nb << ") " << randomData.size() << " points, "
+                   << res1.size() << " vertices" << endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -341,7 +442,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testConvexHull2D() &&testConvexHullCompThickness();
+  bool res = testConvexHull2D() &&testConvexHullCompThickness() && testConvexHullCancelLastAdd()
+    && testParallelAndrewConvexHull();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,164 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPreimage-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the sequence of vertices (std::list versus the default
+ * std::deque) of:
+ * - Preimage2D, for the greedy segmentation of a long noisy contour
+ * into preimages of straight lines, with addBack and addFront,
+ * - LatticePolytope2D, for many random cuts of a large square.
+ *
+ * Usage: testPreimage-benchmark [nbPoints] [nbCuts]
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+#include <list>
+#include <vector>
+#include <deque>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/shapes/fromPoints/StraightLineFrom2Points.h"
+#include "DGtal/geometry/tools/Preimage2D.h"
+#include "DGtal/arithmetic/LatticePolytope2D.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef SpaceND<2, DGtal::int64_t> Space;
+typedef Space::Point Point;
+typedef Space::Vector Vector;
+typedef std::vector<Point> Points;
+typedef StraightLineFrom2Points<Point> StraightLine;
+
+/**
+ * Segments the x-monotone contour @a points greedily into preimages
+ * of straight lines, with addBack if @a forward is 'true' and with
+ * addFront (from the last point) otherwise. Each point P stands for
+ * the vertical segment [P, P - (0,1)].
+ *
+ * @return the total number of vertices of the preimages.
+ */
+template <typename Preimage>
+std::size_t segment( const Points & points, bool forward )
+{
+  const Vector down( 0, 1 );
+  const std::size_t n = points.size();
+  std::size_t nbVertices = 0;
+  std::size_t i = 0;
+  while ( i < n )
+    {
+      const Point & s = points[ forward ? i : n - 1 - i ];
+      Preimage preimage( s, s - down, StraightLine() );
+      for ( ++i; i < n; ++i )
+        {
+          const Point & p = points[ forward ? i : n - 1 - i ];
+          if ( forward ? ! preimage.addBack( p, p - down )
+                       : ! preimage.addFront( p, p - down ) )
+            break;
+        }
+      nbVertices += preimage.pHull().size() + preimage.qHull().size();
+    }
+  return nbVertices;
+}
+
+template <typename Container>
+std::size_t benchPreimage( const std::string & name, const Points & points )
+{
+  typedef Preimage2D<StraightLine, Container> Preimage;
+  Clock clock;
+  clock.startClock();
+  std::size_t nbVertices = segment<Preimage>( points, true )
+    + segment<Preimage>( points, false );
+  double time = clock.stopClock();
+  trace.info() << "Preimage2D with " << name << ": vertices=" << nbVertices
+               << " time=" << time << " ms" << endl;
+  return nbVertices;
+}
+
+/**
+ * Applies the given cuts to a square.
+ * @return the vertices of the resulting polytope.
+ */
+template <typename Container>
+Points benchPolytope( const std::string & name, const DGtal::int64_t range,
+                      const std::vector< std::pair<Vector, DGtal::int64_t> > & cuts )
+{
+  typedef LatticePolytope2D<Space, Container> Polytope;
+  typedef typename Polytope::HalfSpace HalfSpace;
+  Clock clock;
+  clock.startClock();
+  Polytope polytope;
+  polytope.pushBack( Point( -range, -range ) );
+  polytope.pushBack( Point( range, -range ) );
+  polytope.pushBack( Point( range, range ) );
+  polytope.pushBack( Point( -range, range ) );
+  for ( std::size_t i = 0; i < cuts.size(); ++i )
+    polytope.cut( HalfSpace( cuts[ i ].first, cuts[ i ].second ) );
+  double time = clock.stopClock();
+  trace.info() << "LatticePolytope2D with " << name << ": vertices=" << polytope.size()
+               << " time=" << time << " ms" << endl;
+  return Points( polytope.begin(), polytope.end() );
+}
+
+int main( int argc, char** argv )
+{
+  const unsigned int nbPoints = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 1000000;
+  const unsigned int nbCuts = ( argc > 2 ) ? atoi( argv[ 2 ] ) : 20000;
+  trace.info() << "points=" << nbPoints << " cuts=" << nbCuts << endl;
+
+  // noisy contour around a line of slope 7/19
+  Points points;
+  points.reserve( nbPoints );
+  for ( unsigned int x = 0; x < nbPoints; ++x )
+    points.push_back( Point( x, ( 7 * (DGtal::int64_t) x ) / 19 + ( rand() % 100 == 0 ? 1 : 0 ) ) );
+  const bool res1 = benchPreimage< std::list<Point> >( "list", points )
+    == benchPreimage< std::deque<Point> >( "deque", points );
+
+  // cuts tangent to a disk inscribed in the square
+  const DGtal::int64_t range = 1 << 20;
+  std::vector< std::pair<Vector, DGtal::int64_t> > cuts;
+  cuts.reserve( nbCuts );
+  while ( cuts.size() < nbCuts )
+    {
+      const Vector N( rand() % 2001 - 1000, rand() % 2001 - 1000 );
+      if ( N == Vector( 0, 0 ) ) continue;
+      const double norm = std::sqrt( (double) ( N[ 0 ] * N[ 0 ] + N[ 1 ] * N[ 1 ] ) );
+      cuts.push_back( std::make_pair( N, (DGtal::int64_t) std::floor( norm * range ) ) );
+    }
+  const bool res2 = benchPolytope< std::list<Point> >( "list", range, cuts )
+    == benchPolytope< std::deque<Point> >( "deque", range, cuts );
+
+  const bool res = res1 && res2;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,8 @@
 #include <iostream>
 #include <sstream>
 #include <iterator>
+#include <list>
+#include <algorithm>
 
 
 
@@ -95,5 +97,45 @@ int main()
 
   trace.endBlock();
 
-  return 0;
+  trace.beginBlock("Preimage with a list of vertices");
+
+  typedef Preimage2D::Point Point;
+  typedef DGtal::Preimage2D<StraightLine, std::list<Point> > ListPreimage2D;
+
+  //vertical segments crossed by the digital straight line y = floor(7x/19)
+  //added at the back, then at the front
+  bool ok = true;
+  Preimage2D thePreimage2(Point(0,0), Point(0,-1), aStraightLine);
+  ListPreimage2D theListPreimage(Point(0,0), Point(0,-1), aStraightLine);
+  for ( int x = 1; ok && (x < 200); ++x )
+  {
+    Point P( x, (7*x) / 19 );
+    Point Q( x, (7*x) / 19 - 1 );
+    ok = thePreimage2.addBack(P, Q) && theListPreimage.addBack(P, Q)
+      && std::equal( thePreimage2.pHull().begin(), thePreimage2.pHull().end(),
+                     theListPreimage.pHull().begin() )
+      && std::equal( thePreimage2.qHull().begin(), thePreimage2.qHull().end(),
+                     theListPreimage.qHull().begin() );
+  }
+  trace.info() << thePreimage2 << std::endl;
+  Preimage2D thePreimage3(Point(199,73), Point(199,72), aStraightLine);
+  ListPreimage2D theListPreimage2(Point(199,73), Point(199,72), aStraightLine);
+  for ( int x = 198; ok && (x >= 0); --x )
+  {
+    Point P( x, (7*x) / 19 );
+    Point Q( x, (7*x) / 19 - 1 );
+    ok = thePreimage3.addFront(P, Q) && theListPreimage2.addFront(P, Q)
+      && std::equal( thePreimage3.pHull().begin(), thePreimage3.pHull().end(),
+                     theListPreimage2.pHull().begin() )
+      && std::equal( thePreimage3.qHull().begin(), thePreimage3.qHull().end(),
+                     theListPreimage2.qHull().begin() );
+  }
+  trace.info() << thePreimage3 << std::endl;
+  //the next point is not on the line
+  ok = ok && !thePreimage2.addBack(Point(200,75), Point(200,74));
+  trace.emphase() << ( ok ? "Passed." : "Error." ) << std::endl;
+
+  trace.endBlock();
+
+  return ok ? 0 : 1;
 }
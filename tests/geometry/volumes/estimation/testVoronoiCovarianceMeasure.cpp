@@ -96,6 +96,34 @@ bool testVoronoiCovarianceMeasure()
   trace.info() << "(" << nbok << "/" << nb << ") "
                << "sizeCells.size() == 10" << std::endl;
 
+  // Dense storage of the VCM: one matrix per (distinct) site.
+  nbok += ( vcm.sites().size() == 9 && vcm.vcms().size() == 9 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vcm.sites().size() == 9" << std::endl;
+  // Brute-force accumulation of the trace of the VCM of each site.
+  std::map<Point,double> traces;
+  for ( Domain::ConstIterator it = d.begin(), itE = d.end(); it != itE; ++it )
+    {
+      Point q = vcm.voronoiMap()( *it );
+      if ( q != *it && l2( q, *it ) <= 5.0 )
+        traces[ q ] += ( *it - q ).dot( *it - q );
+    }
+  bool ok_dense = true;
+  VCM::Point2MatrixNN vcmMap = vcm.vcmMap();
+  for ( VCM::Index i = 0; i < vcm.sites().size(); ++i )
+    {
+      const Point & q = vcm.sites()[ i ];
+      const Matrix & m = vcm.vcms()[ i ];
+      double tr = m( 0, 0 ) + m( 1, 1 ) + m( 2, 2 );
+      ok_dense = ok_dense && vcm.index( q ) == i
+        && vcmMap[ q ] == m && std::fabs( tr - traces[ q ] ) < 1e-8;
+    }
+  nbok += ok_dense ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "dense VCM == brute-force VCM" << std::endl;
+
   functors::HatPointFunction< Point, double > chi_r( 1.0, 4.0 );
   Matrix vcm_r = vcm.measure( chi_r, Point( 10,10,10 ) );
   trace.info() << "- vcm_r.row(0) = " << vcm_r.row( 0 ) << std::endl;
@@ -35,6 +35,7 @@
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <vector>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -357,9 +358,64 @@ bool testEmptyDomain()
 
 }
 
+/**
+ * Checks that the points of the scanlines are the points of the
+ * domain, in the same order.
+ */
+template <typename TDomain>
+bool checkScanlines( const TDomain & domain )
+{
+  typedef typename TDomain::Point TPoint;
+  typedef typename TDomain::Size Size;
+  std::vector<TPoint> points;
+  for ( Size i = 0; i < domain.nbScanlines(); ++i )
+    {
+      const typename TDomain::Scanline s = domain.scanline( i );
+      if ( s.size != domain.scanlineSize() ) return false;
+      TPoint p = s.start;
+      for ( Size j = 0; j < s.size; ++j, ++p[ 0 ] )
+        points.push_back( p );
+    }
+  return ( points.size() == domain.size() )
+    && std::equal( points.begin(), points.end(), domain.begin() );
+}
+
+bool testScanlines()
+{
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+
+  trace.beginBlock( "Test scanlines." );
+
+  typedef HyperRectDomain< SpaceND<1> > Domain1D;
+  typedef HyperRectDomain< SpaceND<2> > Domain2D;
+  typedef HyperRectDomain< SpaceND<3> > Domain3D;
+  typedef HyperRectDomain< SpaceND<4> > Domain4D;
+  const Domain1D domain1( Domain1D::Point::diagonal( -3 ), Domain1D::Point::diagonal( 5 ) );
+  const Domain2D domain2( Domain2D::Point( -3, 2 ), Domain2D::Point( 5, 7 ) );
+  const Domain3D domain3( Domain3D::Point( -3, 2, -4 ), Domain3D::Point( 5, 7, -1 ) );
+  const Domain3D domain3flat( Domain3D::Point( 0, 2, -4 ), Domain3D::Point( 0, 7, -1 ) );
+  const Domain4D domain4( Domain4D::Point( 1, -1, 0, 3 ), Domain4D::Point( 3, 2, 2, 5 ) );
+
+  ++nb; nbok += ( checkScanlines( domain1 ) && ( domain1.nbScanlines() == 1 ) ) ? 1 : 0;
+  ++nb; nbok += ( checkScanlines( domain2 ) && ( domain2.nbScanlines() == 6 ) ) ? 1 : 0;
+  ++nb; nbok += ( checkScanlines( domain3 ) && ( domain3.nbScanlines() == 24 ) ) ? 1 : 0;
+  ++nb; nbok += ( checkScanlines( domain3flat ) && ( domain3flat.scanlineSize() == 1 ) ) ? 1 : 0;
+  ++nb; nbok += checkScanlines( domain4 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") Scanlines of 1D to 4D domains." << std::endl;
+
+  const Domain3D empty;
+  ++nb; nbok += ( ( empty.nbScanlines() == 0 ) && ( empty.scanlineSize() == 0 ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") No scanline in an empty domain." << std::endl;
+
+  trace.endBlock();
+  return nb == nbok;
+}
+
 int main()
 {
-  if ( testSimpleHyperRectDomain() && testIterator() && testReverseIterator() && testSTLCompat() && testEmptyDomain() )
+  if ( testSimpleHyperRectDomain() && testIterator() && testReverseIterator() && testSTLCompat() && testEmptyDomain()
+       && testScanlines() )
     return 0;
   else
     return 1;
@@ -223,6 +223,45 @@ bool testSetFromImage()
   return nbok == nb;
 }
 
+bool testSetFromVectorImage()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing SetFromImage on scanlines ..." );
+
+  typedef ImageContainerBySTLVector<Domain,int> Image;
+  Domain d( Point(-5,-3), Point(17,9) );
+  Image image(d);
+  for ( Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it )
+    image.setValue( *it, ( 7 * (*it)[0] + 3 * (*it)[1] + 100 ) % 11 );
+
+  for ( int t = 0; t < 11; ++t )
+    {
+      //scanlines versus the points of the domain
+      DigitalSet aSet(d), aSet2(d);
+      DigitalSetInserter<DigitalSet> inserter(aSet), inserter2(aSet2);
+      setFromImage( image, inserter, t );
+      setFromPointsRangeAndFunctor( d.begin(), d.end(), inserter2, image, t );
+      DigitalSet aSet3(d), aSet4(d);
+      DigitalSetInserter<DigitalSet> inserter3(aSet3), inserter4(aSet4);
+      setFromImage( image, inserter3, t, t + 3 );
+      for ( Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it )
+        if ( ( image(*it) >= t ) && ( image(*it) <= t + 3 ) )
+          aSet4.insert( *it );
+      nbok += ( ( aSet.size() == aSet2.size() )
+                && std::equal( aSet.begin(), aSet.end(), aSet2.begin() )
+                && ( aSet3.size() == aSet4.size() )
+                && std::equal( aSet3.begin(), aSet3.end(), aSet4.begin() ) ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -234,7 +273,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testImageFromSet() && testSetFromImage();
+  bool res = testImageFromSet() && testSetFromImage() && testSetFromVectorImage();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
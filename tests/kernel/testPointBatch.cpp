@@ -0,0 +1,275 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPointBatch.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PointBatch and the batch services of
+ * ExactPredicateLpSeparableMetric, ImplicitBall and GaussDigitizer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <limits>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/PointBatch.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PointBatch.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Point>
+Point randomPoint( int range )
+{
+  Point p;
+  for ( Dimension k = 0; k < Point::dimension; ++k )
+    p[ k ] = rand() % ( 2 * range + 1 ) - range;
+  return p;
+}
+
+/**
+ * Compares the services of PointBatch with those of PointVector.
+ */
+template <Dimension dim, typename Integer>
+bool testPointBatch()
+{
+  typedef PointBatch<dim, Integer> Batch;
+  typedef typename Batch::Point Point;
+  typedef typename Batch::Size Size;
+  typedef typename Batch::UnsignedComponent UnsignedComponent;
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+
+  trace.beginBlock( "Testing PointBatch" );
+  const Size n = 1003;
+  std::vector<Point> points, others;
+  for ( Size i = 0; i < n; ++i )
+    {
+      points.push_back( randomPoint<Point>( 1000 ) );
+      others.push_back( randomPoint<Point>( 1000 ) );
+    }
+  Batch batch( points.begin(), points.end() );
+  Batch other( others.begin(), others.end() );
+  bool ok = ( batch.size() == n ) && batch.isValid() && ! batch.empty();
+  for ( Size i = 0; i < n; ++i )
+    ok = ok && ( batch[ i ] == points[ i ] );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << batch << std::endl;
+
+  // arithmetic
+  const Point v = randomPoint<Point>( 100 );
+  const Integer coeff = 3;
+  batch += v;
+  batch -= other;
+  batch *= coeff;
+  batch += other;
+  batch -= v;
+  ok = true;
+  for ( Size i = 0; i < n; ++i )
+    {
+      points[ i ] = ( points[ i ] + v - others[ i ] ) * coeff + others[ i ] - v;
+      ok = ok && ( batch[ i ] == points[ i ] );
+    }
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") arithmetic" << std::endl;
+
+  // inner products and norms
+  std::vector<Integer> dots( n ), squares( n );
+  std::vector<double> norms( n );
+  std::vector<UnsignedComponent> norms1( n ), normsInf( n );
+  batch.dot( v, dots.data() );
+  batch.squaredNorm( squares.data() );
+  batch.norm( norms.data() );
+  batch.norm1( norms1.data() );
+  batch.normInfinity( normsInf.data() );
+  ok = true;
+  for ( Size i = 0; i < n; ++i )
+    ok = ok && ( dots[ i ] == points[ i ].dot( v ) )
+      && ( squares[ i ] == points[ i ].dot( points[ i ] ) )
+      && ( norms[ i ] == points[ i ].norm() )
+      && ( norms1[ i ] == points[ i ].norm1() )
+      && ( normsInf[ i ] == points[ i ].normInfinity() );
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") inner products and norms" << std::endl;
+
+  // norms of a point with the most negative component
+  Batch extreme;
+  Point minimum;
+  minimum[ 0 ] = std::numeric_limits<Integer>::min();
+  extreme.push_back( minimum );
+  UnsignedComponent extremeNorm1, extremeNormInf;
+  extreme.norm1( &extremeNorm1 );
+  extreme.normInfinity( &extremeNormInf );
+  const UnsignedComponent minimumAbs = UnsignedComponent( std::numeric_limits<Integer>::max() ) + 1;
+  nbok += ( extremeNorm1 == minimumAbs && extremeNormInf == minimumAbs ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") norms of the most negative component" << std::endl;
+
+  // comparison masks
+  const Point lower = Point::diagonal( -1500 );
+  const Point upper = Point::diagonal( 1500 );
+  std::unique_ptr<bool[]> lowerMask( new bool[ n ] );
+  std::unique_ptr<bool[]> upperMask( new bool[ n ] );
+  std::unique_ptr<bool[]> insideMask( new bool[ n ] );
+  batch.isLower( upper, lowerMask.get() );
+  batch.isUpper( lower, upperMask.get() );
+  batch.isInside( lower, upper, insideMask.get() );
+  ok = true;
+  Size nbInside = 0;
+  for ( Size i = 0; i < n; ++i )
+    {
+      ok = ok && ( lowerMask[ i ] == points[ i ].isLower( upper ) )
+        && ( upperMask[ i ] == points[ i ].isUpper( lower ) )
+        && ( insideMask[ i ] == ( points[ i ].isLower( upper ) && points[ i ].isUpper( lower ) ) );
+      nbInside += insideMask[ i ] ? 1 : 0;
+    }
+  nbok += ( ok && ( nbInside != 0 ) && ( nbInside != n ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") comparison masks, inside="
+               << nbInside << std::endl;
+
+  batch.set( 0, v );
+  batch.resize( n + 1 );
+  nbok += ( ( batch[ 0 ] == v ) && ( batch[ n ] == Point::zero )
+            && ( batch.size() == n + 1 ) ) ? 1 : 0; nb++;
+  batch.clear();
+  nbok += batch.empty() ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") set, resize and clear" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Compares the batch distances with the distances of each point.
+ */
+template <typename Metric>
+bool testMetric()
+{
+  typedef typename Metric::Point Point;
+  typedef typename Metric::Batch Batch;
+  typedef typename Metric::RawValue RawValue;
+  typedef typename Metric::Value Value;
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+
+  trace.beginBlock( "Testing batch distances" );
+  Metric metric;
+  std::vector<Point> points;
+  for ( unsigned int i = 0; i < 1000; ++i )
+    points.push_back( randomPoint<Point>( 1000 ) );
+  const Batch batch( points.begin(), points.end() );
+  const Point origin = randomPoint<Point>( 1000 );
+  std::vector<RawValue> raw( batch.size() );
+  std::vector<Value> values( batch.size() );
+  metric.rawDistances( origin, batch, raw.data() );
+  metric.distances( origin, batch, values.data() );
+  for ( unsigned int i = 0; i < points.size(); ++i )
+    {
+      nbok += ( ( raw[ i ] == metric.rawDistance( origin, points[ i ] ) )
+                && ( values[ i ] == metric( origin, points[ i ] ) ) ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << metric << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Compares the batch digitization of a ball with the digitization
+ * of each point.
+ */
+template <typename Space>
+bool testGaussDigitizer()
+{
+  typedef typename Space::RealPoint RealPoint;
+  typedef ImplicitBall<Space> Ball;
+  typedef GaussDigitizer<Space, Ball> Digitizer;
+  typedef typename Digitizer::Domain Domain;
+  typedef typename Digitizer::Batch Batch;
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+
+  trace.beginBlock( "Testing batch Gauss digitization of a ball" );
+  Ball ball( RealPoint::diagonal( 0.25 ), 7.3 );
+  Digitizer dig;
+  dig.attach( ball );
+  dig.init( ball.getLowerBound(), ball.getUpperBound(), 0.5 );
+  const Domain domain = dig.getDomain();
+  const Batch batch( domain.begin(), domain.end() );
+  std::vector<Orientation> orientations( batch.size() );
+  std::unique_ptr<bool[]> mask( new bool[ batch.size() ] );
+  dig.orientations( batch, orientations.data() );
+  dig( batch, mask.get() );
+  unsigned int nbInside = 0;
+  bool ok = true;
+  for ( std::size_t i = 0; i < batch.size(); ++i )
+    {
+      ok = ok && ( orientations[ i ] == dig.orientation( batch[ i ] ) )
+        && ( mask[ i ] == dig( batch[ i ] ) );
+      nbInside += mask[ i ] ? 1 : 0;
+    }
+  nbok += ( ok && ( nbInside > 0 ) && ( nbInside < batch.size() ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") points=" << batch.size()
+               << " inside=" << nbInside << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PointBatch" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef SpaceND<2, DGtal::int32_t> Space2;
+  typedef SpaceND<3, DGtal::int64_t> Space3;
+  bool res = testPointBatch<2, DGtal::int32_t>()
+    && testPointBatch<3, DGtal::int32_t>()
+    && testPointBatch<3, DGtal::int64_t>()
+    && testMetric< ExactPredicateLpSeparableMetric<Space2, 2> >()
+    && testMetric< ExactPredicateLpSeparableMetric<Space3, 2> >()
+    && testMetric< ExactPredicateLpSeparableMetric<Space3, 3> >()
+    && testMetric< ExactPredicateLpSeparableMetric<Space2, 1> >()
+    && testGaussDigitizer<Space2>()
+    && testGaussDigitizer<Space3>();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
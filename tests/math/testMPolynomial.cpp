@@ -33,6 +33,7 @@
 #include <sstream>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/MPolynomial.h"
+#include "DGtal/math/MPolynomialScanlineEvaluator.h"
 #include "DGtal/io/readers/MPolynomialReader.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -106,6 +107,26 @@ bool testMPolynomialSpeed( double step = 0.01 )
   trace.info() << "Total1 = " << total1 << std::endl;
   trace.endBlock();
 
+  trace.beginBlock ( "Testing block ... Evaluation speed of compiled mpolynomials along scanlines" );
+  MPolynomialScanlineEvaluator<double> E( P );
+  std::vector<double> values( (std::size_t) ceil( 2.0 / step ) );
+  std::vector<double> work;
+  double total3 = 0.0;
+  for ( double y = -1.0; y < 1.0; y += step )
+    {
+      for ( double z = -1.0; z < 1.0; z += step )
+        {
+          // same abscissas as the loops above.
+          std::size_t n = 0;
+          for ( double x = -1.0; x < 1.0; x += step ) ++n;
+          E.evaluateScanline( y, z, -1.0, step, n, values.data(), work );
+          for ( std::size_t i = 0; i < n; ++i )
+            total3 += values[ i ];
+        }
+    }
+  trace.info() << "Total3 = " << total3 << std::endl;
+  trace.endBlock();
+
   trace.beginBlock ( "Testing block ... Same computation in C." );
   double total2 = 0.0;
   for ( double x = -1.0; x < 1.0; x += step )
@@ -126,6 +147,10 @@ bool testMPolynomialSpeed( double step = 0.01 )
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "
                << "fabs( total2 - total ) < 1e-8" << std::endl;
+  nbok += fabs( total3 - total ) < 1e-6 ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "fabs( total3 - total ) < 1e-6" << std::endl;
 
   trace.info() << "For information, ImaGene::Polynomial3 takes 164ms for step=0.01 and 1604ms for step = 0.005." << std::endl;
   return nbok == nb;
@@ -181,6 +206,39 @@ bool testMPolynomial()
   MPolynomial<3,double> P;
   P = Xe_k<3,double>( 2, 7 ) + Xe_k<3,double>( 1, 3 );
   trace.info() << "P=" << P << std::endl;
+
+  MPolynomialScanlineEvaluator<double> EQ( Q );
+  trace.info() << EQ << std::endl;
+  nbok += EQ.isValid() && EQ.degreeX() == 4 ? 1 : 0; 
+  nb++;
+  std::vector<double> values( 11 );
+  EQ.evaluateScanline( 0.5, -1.5, -1.0, 0.2, values.size(), values.data() );
+  bool ok_scan = true;
+  for ( std::size_t i = 0; i < values.size(); ++i )
+    {
+      double x = -1.0 + 0.2 * (double) i;
+      ok_scan = ok_scan && fabs( values[ i ] - Q( x )( 0.5 )( -1.5 ) ) < 1e-10
+        && fabs( EQ( x, 0.5, -1.5 ) - Q( x )( 0.5 )( -1.5 ) ) < 1e-10;
+    }
+  nbok += ok_scan ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "scanline evaluation of Q == Q(x)(y)(z)" << std::endl;
+  MPolynomialScanlineEvaluator<double> EZ;
+  nbok += EZ.degreeX() == -1 && EZ( 1.0, 2.0, 3.0 ) == 0.0 ? 1 : 0; 
+  nb++;
+  MPolynomial<3,double> Z;
+  MPolynomialScanlineEvaluator<double> EZ2( Z );
+  trace.info() << EZ2 << std::endl;
+  EZ2.evaluateScanline( 0.5, -1.5, -1.0, 0.2, values.size(), values.data() );
+  bool ok_zero = EZ2.isValid() && EZ2.degreeX() == -1
+    && EZ2( 1.0, 2.0, 3.0 ) == 0.0;
+  for ( std::size_t i = 0; i < values.size(); ++i )
+    ok_zero = ok_zero && values[ i ] == 0.0;
+  nbok += ok_zero ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "scanline evaluation of the zero polynomial" << std::endl;
   return nbok == nb;
 }
 
@@ -37,7 +37,10 @@
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/shapes/parametric/Ellipse2D.h"
 #include "DGtal/shapes/parametric/Flower2D.h"
+#include "DGtal/shapes/implicit/ImplicitPolynomial3Shape.h"
+#include "DGtal/math/MPolynomial.h"
 #include "DGtal/shapes/Shapes.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/topology/helpers/Surfaces.h"
 #include "DGtal/geometry/curves/GridCurve.h"
 #include "DGtal/shapes/CDigitalOrientedShape.h"
@@ -180,6 +183,111 @@ bool testGaussDigitizer()
   return nbok == nb;
 }
 
+/**
+ * Checks that the scanline digitization of an implicit polynomial
+ * surface gives the same set as the point by point digitization.
+ */
+bool testDigitizeByScanlines()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing GaussDigitizer::digitizeByScanlines." );
+  typedef Z3i::Space Space;
+  typedef Z3i::Domain Domain;
+  typedef Space::RealPoint RealPoint;
+  typedef ImplicitPolynomial3Shape<Space> Shape;
+  typedef GaussDigitizer<Space,Shape> Digitizer;
+  // Goursat-like surface x^4+y^4+z^4-2(x^2+y^2+z^2)+0.5
+  MPolynomial<3,double> P = mmonomial<double>( 4, 0, 0 )
+    + mmonomial<double>( 0, 4, 0 ) + mmonomial<double>( 0, 0, 4 )
+    - 2.0 * mmonomial<double>( 2, 0, 0 ) - 2.0 * mmonomial<double>( 0, 2, 0 )
+    - 2.0 * mmonomial<double>( 0, 0, 2 ) + 0.5 * mmonomial<double>( 0, 0, 0 );
+  Shape shape( P );
+  Digitizer dig;
+  dig.attach( shape );
+  dig.init( RealPoint( -2.0, -2.0, -2.0 ), RealPoint( 2.0, 2.0, 2.0 ), 0.1 );
+  Domain domain = dig.getDomain();
+  Z3i::DigitalSet set1( domain );
+  Z3i::DigitalSet set2( domain );
+  Shapes<Domain>::digitalShaper( set1, dig );
+  dig.digitizeByScanlines( set2 );
+  trace.info() << "|set1|=" << set1.size() << " |set2|=" << set2.size() << std::endl;
+  bool same = set1.size() == set2.size();
+  for ( Z3i::DigitalSet::ConstIterator it = set1.begin(), itE = set1.end();
+        same && it != itE; ++it )
+    same = set2( *it );
+  nbok += ( same && set1.size() > 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "digitalShaper == digitizeByScanlines" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that the dense image digitization of a flower gives the same
+ * points as digitalShaper, in parallel or not, and that the
+ * coarse-to-fine digitization is exact for a step smaller than its
+ * petals.
+ */
+bool testDigitalImageShaper()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Shapes::digitalImageShaper." );
+  typedef Z2i::Space Space;
+  typedef Z2i::Domain Domain;
+  typedef Z2i::Point Point;
+  typedef Flower2D<Space> Shape;
+  typedef GaussDigitizer<Space,Shape> Digitizer;
+  Shape flower( 0.5, -2.3, 5.0, 0.7, 6, 0.3 );
+  Digitizer dig;
+  dig.attach( flower );
+  dig.init( flower.getLowerBound(), flower.getUpperBound(), 0.05 );
+  Domain domain = dig.getDomain();
+  Z2i::DigitalSet set( domain );
+  Z2i::DigitalSet coarseSet( domain );
+  Shapes<Domain>::digitalShaper( set, dig );
+  Shapes<Domain>::digitalShaper( coarseSet, dig, 4 );
+  nbok += ( set.size() > 0 && set.size() == coarseSet.size()
+            && std::equal( set.begin(), set.end(), coarseSet.begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "|set|=" << set.size() << " coarse-to-fine digitalShaper" << std::endl;
+
+  Z2i::DigitalSet parallelSet( domain );
+  Shapes<Domain>::digitalShaper( parallelSet, dig, 1, true );
+  nbok += ( set.size() == parallelSet.size()
+            && std::equal( set.begin(), set.end(), parallelSet.begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "parallel digitalShaper" << std::endl;
+
+  // The image domain is larger than the digitizer domain on some sides.
+  const Domain imageDomain( domain.lowerBound() - Point( 7, 3 ),
+                            domain.upperBound() - Point( 2, -5 ) );
+  ImageContainerBySTLVector<Domain, unsigned char> image( imageDomain );
+  ImageContainerBySTLVector<Domain, bool> bitmask( imageDomain );
+  Shapes<Domain>::digitalImageShaper( image, dig, 1, 0 );
+  Shapes<Domain>::digitalImageShaper( bitmask, dig, true, false, 4 );
+  bool same = true;
+  for ( Domain::ConstIterator it = imageDomain.begin(), itE = imageDomain.end();
+        same && it != itE; ++it )
+    {
+      const bool inside = domain.isInside( *it ) && set( *it );
+      const bool coarseInside = domain.isInside( *it ) && coarseSet( *it );
+      same = ( image( *it ) == ( inside ? 1 : 0 ) ) && ( bitmask( *it ) == coarseInside );
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "digitalImageShaper == digitalShaper" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -191,7 +299,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testConcept() && testGaussDigitizer(); // && ... other tests
+  bool res = testConcept() && testGaussDigitizer()
+    && testDigitizeByScanlines() && testDigitalImageShaper(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;